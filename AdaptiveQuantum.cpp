@@ -0,0 +1,117 @@
+#include "AdaptiveQuantum.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+AdaptiveQuantum::AdaptiveQuantum(const Options &options, int initialQuantum)
+    : percentile(options.quantumPercentile), retuneInterval(options.retuneInterval), quantum(initialQuantum),
+      counts(bucketOf(std::numeric_limits<int>::max()) + 1, 0.0)
+{
+    if (!(percentile > 0.0 && percentile <= 100.0))
+    {
+        throw std::runtime_error("The quantum percentile must be in (0, 100]");
+    }
+    if (retuneInterval <= 0)
+    {
+        throw std::runtime_error("The retune interval must be positive");
+    }
+    history.emplace_back(0, quantum);
+}
+
+int AdaptiveQuantum::record(int burstLength, int currentTime)
+{
+    counts[bucketOf(burstLength)] += 1.0;
+    if (++sinceRetune >= retuneInterval)
+    {
+        retune(currentTime);
+    }
+    return quantum;
+}
+
+int AdaptiveQuantum::getQuantum() const
+{
+    return quantum;
+}
+
+double AdaptiveQuantum::getPercentile() const
+{
+    return percentile;
+}
+
+int AdaptiveQuantum::getRetuneInterval() const
+{
+    return retuneInterval;
+}
+
+int AdaptiveQuantum::getRetuneCount() const
+{
+    return retuneCount;
+}
+
+const std::vector<std::pair<int, int>> &AdaptiveQuantum::getHistory() const
+{
+    return history;
+}
+
+int AdaptiveQuantum::bucketOf(int length)
+{
+    if (length < EXACT_BUCKETS)
+    {
+        return std::max(length, 0);
+    }
+    int exponent = 0;
+    while ((length >> exponent) > 1)
+    {
+        exponent++;
+    }
+    int shift = exponent - SUB_BUCKET_BITS;
+    int sub = (length >> shift) & ((1 << SUB_BUCKET_BITS) - 1);
+    return EXACT_BUCKETS + ((exponent - 4) << SUB_BUCKET_BITS) + sub;
+}
+
+int AdaptiveQuantum::upperBound(int bucket)
+{
+    if (bucket < EXACT_BUCKETS)
+    {
+        return bucket;
+    }
+    int exponent = ((bucket - EXACT_BUCKETS) >> SUB_BUCKET_BITS) + 4;
+    int sub = (bucket - EXACT_BUCKETS) & ((1 << SUB_BUCKET_BITS) - 1);
+    int shift = exponent - SUB_BUCKET_BITS;
+    int lower = ((1 << SUB_BUCKET_BITS) + sub) << shift;
+    return lower + ((1 << shift) - 1);
+}
+
+void AdaptiveQuantum::retune(int currentTime)
+{
+    sinceRetune = 0;
+    retuneCount++;
+
+    double total = 0.0;
+    for (double count : counts)
+    {
+        total += count;
+    }
+    // The smallest bucket by which the target share of bursts has completed; the tolerance
+    // keeps rounding in the decayed counts from pushing an exact percentile one bucket up.
+    double target = total * percentile / 100.0 * (1.0 - 1e-12);
+    double cumulative = 0.0;
+    int bucket = 0;
+    while (bucket + 1 < static_cast<int>(counts.size()) && cumulative + counts[bucket] < target)
+    {
+        cumulative += counts[bucket];
+        bucket++;
+    }
+
+    int retuned = std::max(upperBound(bucket), 1);
+    if (retuned != quantum)
+    {
+        quantum = retuned;
+        history.emplace_back(currentTime, quantum);
+    }
+
+    for (double &count : counts)
+    {
+        count *= 0.5;
+    }
+}
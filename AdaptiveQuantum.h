@@ -0,0 +1,109 @@
+/**
+ * @file AdaptiveQuantum.h
+ * @brief Defines the `AdaptiveQuantum` class retuning the Round Robin quantum from observed CPU bursts.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef ADAPTIVEQUANTUM_H
+#define ADAPTIVEQUANTUM_H
+
+#include "Options.h"
+#include <utility>
+#include <vector>
+
+/**
+ * @class AdaptiveQuantum
+ * @brief Chooses the time quantum as a percentile of the lengths of recently completed CPU bursts.
+ *
+ * Completed burst lengths are counted in a streaming histogram: lengths below 16 have a bucket
+ * each, and every longer power-of-two range is split into 8 buckets, so a percentile is known to
+ * within 12.5% in constant memory. Every `retuneInterval` completed bursts the quantum becomes
+ * the upper end of the bucket holding the target percentile, so that about that share of bursts
+ * finishes within one slice, and the counts are halved so that the quantum follows changes in
+ * the workload.
+ *
+ * A new quantum applies to the time slices that start after it is chosen.
+ */
+class AdaptiveQuantum
+{
+public:
+    /**
+     * @brief Constructs a new `AdaptiveQuantum` object.
+     *
+     * @param options The simulation options (`quantumPercentile` and `retuneInterval` are used).
+     * @param initialQuantum The quantum used until the first retune.
+     * @throws std::runtime_error if the percentile is not in (0, 100] or the interval is not positive.
+     */
+    AdaptiveQuantum(const Options &options, int initialQuantum);
+
+    /**
+     * @brief Counts a completed CPU burst and retunes the quantum if the interval is over.
+     *
+     * @param burstLength The length of the completed burst.
+     * @param currentTime The current simulation time.
+     * @return The quantum for the time slices that start from now on.
+     */
+    int record(int burstLength, int currentTime);
+
+    /**
+     * @brief Returns the current quantum.
+     */
+    int getQuantum() const;
+
+    /**
+     * @brief Returns the target percentile of completed bursts.
+     */
+    double getPercentile() const;
+
+    /**
+     * @brief Returns the number of completed bursts between retunes.
+     */
+    int getRetuneInterval() const;
+
+    /**
+     * @brief Returns the number of retunes so far.
+     */
+    int getRetuneCount() const;
+
+    /**
+     * @brief Returns (time, quantum) of the initial quantum and of every retune that changed it.
+     */
+    const std::vector<std::pair<int, int>> &getHistory() const;
+
+private:
+    /**
+     * @brief Returns the histogram bucket counting bursts of a given length.
+     */
+    static int bucketOf(int length);
+
+    /**
+     * @brief Returns the longest burst length counted in a bucket.
+     */
+    static int upperBound(int bucket);
+
+    /**
+     * @brief Sets the quantum to the target percentile of the histogram and halves the counts.
+     */
+    void retune(int currentTime);
+
+    /**
+     * @brief Lengths below this have a bucket each.
+     */
+    static constexpr int EXACT_BUCKETS = 16;
+
+    /**
+     * @brief log2 of the number of buckets every longer power-of-two range is split into.
+     */
+    static constexpr int SUB_BUCKET_BITS = 3;
+
+    double percentile;                          /**< @brief Target percentile of completed bursts, in (0, 100]. */
+    int retuneInterval;                         /**< @brief Completed bursts between retunes. */
+    int quantum;                                /**< @brief The current quantum. */
+    int sinceRetune = 0;                        /**< @brief Bursts completed since the last retune. */
+    int retuneCount = 0;                        /**< @brief Number of retunes so far. */
+    std::vector<double> counts;                 /**< @brief Decayed number of completed bursts in each bucket. */
+    std::vector<std::pair<int, int>> history;   /**< @brief (time, quantum) of every change of the quantum. */
+};
+
+#endif // ADAPTIVEQUANTUM_H
@@ -0,0 +1,156 @@
+#include "BoundedReadyQueue.h"
+#include <algorithm>
+#include <stdexcept>
+
+BoundedReadyQueue::BoundedReadyQueue(ReadyQueue *inner, const Options &options)
+    : inner(inner), policy(options.admission), capacity(options.queueCapacity),
+      tokenRate(options.tokenRate), tokenBurst(options.tokenBurst), tokens(options.tokenBurst)
+{
+    if (policy != "reject" && policy != "drop-oldest" && policy != "drop-lowest-priority" && policy != "token-bucket")
+    {
+        throw std::runtime_error("Invalid admission policy: " + policy);
+    }
+    if (capacity < 0)
+    {
+        throw std::runtime_error("The queue capacity must not be negative");
+    }
+    if (policy == "token-bucket" && (tokenRate <= 0.0 || tokenBurst < 1.0))
+    {
+        throw std::runtime_error("The token bucket needs a positive --token-rate and a --token-burst of at least 1");
+    }
+}
+
+void BoundedReadyQueue::addProcess(const Process &p)
+{
+    inner->addProcess(p);
+    order.insert(keyOf(p));
+    queued.emplace(p.process_id, p);
+}
+
+Process BoundedReadyQueue::getNextProcess()
+{
+    if (queued.empty())
+    {
+        throw std::runtime_error("Error: Attempting to get a process from an empty ready queue!");
+    }
+
+    while (true)
+    {
+        Process next = inner->getNextProcess();
+        if (shed.erase(next.process_id) > 0)
+        {
+            continue;
+        }
+
+        order.erase(keyOf(queued.at(next.process_id)));
+        queued.erase(next.process_id);
+        if (queued.empty() && !shed.empty())
+        {
+            // Everything left in the wrapped policy was shed.
+            while (!inner->isEmpty())
+            {
+                inner->getNextProcess();
+            }
+            shed.clear();
+        }
+        return next;
+    }
+}
+
+bool BoundedReadyQueue::isEmpty() const
+{
+    return queued.empty();
+}
+
+bool BoundedReadyQueue::preempts(const Process &arriving, const Process &running) const
+{
+    return inner->preempts(arriving, running);
+}
+
+void BoundedReadyQueue::chargeUsage(Process &p, int usedTime)
+{
+    inner->chargeUsage(p, usedTime);
+}
+
+bool BoundedReadyQueue::takeToken(int currentTime)
+{
+    if (policy != "token-bucket")
+    {
+        return true;
+    }
+
+    tokens = std::min(tokenBurst, tokens + tokenRate * (currentTime - lastRefill));
+    lastRefill = currentTime;
+    if (tokens < 1.0)
+    {
+        rateLimitedCount++;
+        return false;
+    }
+    tokens -= 1.0;
+    return true;
+}
+
+bool BoundedReadyQueue::makeRoom(const Process &p, std::vector<Process> &dropped)
+{
+    if (capacity == 0 || static_cast<int>(queued.size()) < capacity)
+    {
+        return true;
+    }
+
+    std::pair<int, int> victim;
+    if (policy == "drop-oldest")
+    {
+        victim = *order.begin();
+    }
+    else if (policy == "drop-lowest-priority" && keyOf(p).first < order.rbegin()->first)
+    {
+        victim = *order.rbegin();
+    }
+    else
+    {
+        rejectedCount++;
+        return false;
+    }
+
+    order.erase(victim);
+    auto entry = queued.find(victim.second);
+    dropped.push_back(entry->second);
+    queued.erase(entry);
+    shed.insert(victim.second);
+    shedCount++;
+    return true;
+}
+
+std::pair<int, int> BoundedReadyQueue::keyOf(const Process &p) const
+{
+    if (policy == "drop-lowest-priority")
+    {
+        return {p.priority, p.process_id};
+    }
+    return {p.ready_time, p.process_id};
+}
+
+const std::string &BoundedReadyQueue::getPolicy() const
+{
+    return policy;
+}
+
+int BoundedReadyQueue::getCapacity() const
+{
+    return capacity;
+}
+
+int BoundedReadyQueue::getRejectedCount() const
+{
+    return rejectedCount;
+}
+
+int BoundedReadyQueue::getRateLimitedCount() const
+{
+    return rateLimitedCount;
+}
+
+int BoundedReadyQueue::getShedCount() const
+{
+    return shedCount;
+}
@@ -0,0 +1,148 @@
+/**
+ * @file BoundedReadyQueue.h
+ * @brief Defines the bounded ready queue class adding admission control to a CPU scheduling policy.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef BOUNDEDREADYQUEUE_H
+#define BOUNDEDREADYQUEUE_H
+
+#include "ReadyQueue.h"
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Ready queue decorator that limits how many processes may wait and sheds load when full.
+ *
+ * The order in which processes run is still decided by the wrapped policy. Admission is decided
+ * for arriving processes only: processes that were already admitted (preempted, time-sliced, or
+ * back from I/O) always re-enter the queue.
+ *
+ * Admission policies, applied when an arrival finds `capacity` processes waiting:
+ *   - "reject": the arrival is rejected.
+ *   - "drop-oldest": the process that has waited longest is shed to make room.
+ *   - "drop-lowest-priority": the queued process with the largest priority value is shed, unless
+ *     the arrival's priority is no better, in which case the arrival is rejected.
+ *   - "token-bucket": arrivals are rate-limited by a token bucket and rejected when the queue is full.
+ *
+ * The wrapped policy cannot remove arbitrary processes, so shed processes are deleted lazily: they
+ * are only marked, and skipped when the wrapped policy hands them out.
+ */
+class BoundedReadyQueue : public ReadyQueue
+{
+public:
+    /**
+     * @brief Wraps a ready queue.
+     *
+     * @param inner The policy deciding the order of admitted processes (ownership is taken).
+     * @param options The simulation options (`queueCapacity`, `admission`, `tokenRate` and `tokenBurst` are used).
+     * @throws std::runtime_error if the admission policy or its settings are invalid.
+     */
+    BoundedReadyQueue(ReadyQueue *inner, const Options &options);
+
+    /**
+     * @brief Adds an admitted process to the queue.
+     *
+     * @param p The Process object to be added to the queue.
+     */
+    void addProcess(const Process &p) override;
+
+    /**
+     * @brief Retrieves the next process chosen by the wrapped policy, skipping shed processes.
+     *
+     * @return The next Process object to run.
+     * @throws std::runtime_error if the queue is empty.
+     */
+    Process getNextProcess() override;
+
+    /**
+     * @brief Checks if no admitted process is waiting.
+     *
+     * @return True if the queue is empty, false otherwise.
+     */
+    bool isEmpty() const override;
+
+    /**
+     * @brief Forwards to the wrapped policy.
+     */
+    bool preempts(const Process &arriving, const Process &running) const override;
+
+    /**
+     * @brief Forwards to the wrapped policy.
+     */
+    void chargeUsage(Process &p, int usedTime) override;
+
+    /**
+     * @brief Takes a token for an arrival under the "token-bucket" policy.
+     *
+     * The bucket refills at `tokenRate` tokens per time unit up to `tokenBurst` tokens.
+     * Under the other policies every arrival passes.
+     *
+     * @param currentTime The arrival time.
+     * @return True if the arrival may enter, false if it is rate-limited.
+     */
+    bool takeToken(int currentTime);
+
+    /**
+     * @brief Decides whether an arrival that has to wait may join the queue.
+     *
+     * @param p The arriving process.
+     * @param dropped Receives the queued process shed to make room, if any.
+     * @return True if the arrival may be added with `addProcess`, false if it is rejected.
+     */
+    bool makeRoom(const Process &p, std::vector<Process> &dropped);
+
+    /**
+     * @brief Gets the admission policy.
+     */
+    const std::string &getPolicy() const;
+
+    /**
+     * @brief Gets the queue capacity (0 for none).
+     */
+    int getCapacity() const;
+
+    /**
+     * @brief Gets the number of arrivals rejected because the queue was full.
+     */
+    int getRejectedCount() const;
+
+    /**
+     * @brief Gets the number of arrivals rejected by the token bucket.
+     */
+    int getRateLimitedCount() const;
+
+    /**
+     * @brief Gets the number of queued processes shed to make room for arrivals.
+     */
+    int getShedCount() const;
+
+private:
+    /**
+     * @brief Gets the key ordering queued processes by how willingly they are shed (the largest is shed first
+     *        under "drop-lowest-priority", the smallest under "drop-oldest").
+     */
+    std::pair<int, int> keyOf(const Process &p) const;
+
+    std::unique_ptr<ReadyQueue> inner;             /**< @brief The wrapped policy. */
+    std::string policy;                            /**< @brief The admission policy. */
+    int capacity = 0;                              /**< @brief Maximum number of waiting processes (0 for none). */
+    double tokenRate = 0.0;                        /**< @brief Tokens added per time unit. */
+    double tokenBurst = 0.0;                       /**< @brief Maximum number of tokens. */
+    double tokens = 0.0;                           /**< @brief Tokens currently in the bucket. */
+    int lastRefill = 0;                            /**< @brief Time up to which the bucket has been refilled. */
+    std::unordered_map<int, Process> queued;       /**< @brief Admitted waiting processes by process ID. */
+    std::set<std::pair<int, int>> order;           /**< @brief Keys of the waiting processes (see `keyOf`). */
+    std::unordered_set<int> shed;                  /**< @brief Shed processes still held by the wrapped policy. */
+    int rejectedCount = 0;                         /**< @brief Arrivals rejected because the queue was full. */
+    int rateLimitedCount = 0;                      /**< @brief Arrivals rejected by the token bucket. */
+    int shedCount = 0;                             /**< @brief Queued processes shed to make room. */
+};
+
+#endif // BOUNDEDREADYQUEUE_H
@@ -1,16 +1,73 @@
 #include "CPU.h"
+#include "Checkpoint.h"
 #include <stdexcept>
 #include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <sstream>
 
-CPU::CPU() : runningProcess(nullptr) {}
+CPU::CPU() {}
 
-CPU::~CPU()
+CPU::CPU(int contextSwitchCost, int cacheMissPenalty, int cacheWarmWindow, int id, const CoreType &type, int wakeLatency)
+    : contextSwitchCost(contextSwitchCost), cacheMissPenalty(cacheMissPenalty),
+      cacheWarmWindow(cacheWarmWindow), id(id), type(type), wakeLatency(wakeLatency)
 {
-    if (runningProcess != nullptr)
+    if (contextSwitchCost < 0 || cacheMissPenalty < 0 || cacheWarmWindow < 0)
+    {
+        throw std::runtime_error("The switch cost, cache-miss penalty and cache-warm window cannot be negative");
+    }
+    if (wakeLatency < 0)
     {
+        throw std::runtime_error("The wake-up latency cannot be negative");
+    }
+}
+
+std::vector<CoreType> CoreType::parseList(const std::string &list)
+{
+    std::vector<CoreType> cores;
+    std::stringstream entries(list);
+    std::string entry;
 
-        delete runningProcess;
+    while (std::getline(entries, entry, ','))
+    {
+        try
+        {
+            int count = 1;
+            size_t times = entry.find('x');
+            if (times != std::string::npos)
+            {
+                count = std::stoi(entry.substr(0, times));
+                entry = entry.substr(times + 1);
+            }
+
+            std::stringstream fields(entry);
+            std::string field;
+            CoreType core;
+
+            std::getline(fields, field, ':');
+            core.speed = std::stod(field);
+            core.activePower = core.speed * core.speed * core.speed;
+            if (std::getline(fields, field, ':'))
+            {
+                core.activePower = std::stod(field);
+            }
+            if (std::getline(fields, field, ':'))
+            {
+                core.idlePower = std::stod(field);
+            }
+            if (count < 1 || core.speed <= 0.0)
+            {
+                throw std::invalid_argument(entry);
+            }
+            cores.insert(cores.end(), count, core);
+        }
+        catch (const std::exception &)
+        {
+            throw std::runtime_error("Invalid core description: " + entry);
+        }
     }
+
+    return cores;
 }
 
 const Process *CPU::getRunningProcess() const
@@ -19,7 +76,7 @@ const Process *CPU::getRunningProcess() const
     {
         throw std::runtime_error("Error: Attempting to get a process from an empty CPU!");
     }
-    return runningProcess;
+    return runningProcess.get();
 }
 
 bool CPU::isIdle() const
@@ -29,16 +86,26 @@ bool CPU::isIdle() const
 
 int CPU::loadProcess(const Process &p, int currentTime)
 {
-    runningProcess = new Process(p);
+    runningProcess = std::make_unique<Process>(p);
     runningProcess->start_time = currentTime;
+
+    bool warmCache = p.last_cpu == id && p.last_run_end >= 0 && currentTime - p.last_run_end <= cacheWarmWindow;
+    currentWakeTime = (currentTime > idleSince || contextSwitchCount == 0) ? wakeLatency : 0;
+    currentSwitchOverhead = currentWakeTime + contextSwitchCost + (warmCache ? 0 : cacheMissPenalty);
+    contextSwitchCount++;
+    if (warmCache)
+    {
+        warmSwitchCount++;
+    }
+
     if (!runningProcess->hasStarted)
     {
         runningProcess->hasStarted = true;
-        runningProcess->response_time = currentTime - runningProcess->arrival_time;
+        runningProcess->response_time = currentTime + currentSwitchOverhead - runningProcess->arrival_time;
     }
-    runningProcess->wait_time = currentTime - runningProcess->arrival_time - runningProcess->completed_burst_time;
+    runningProcess->wait_time += currentTime - runningProcess->ready_time;
 
-    runningProcess->completion_time = currentTime + p.burst_time - p.completed_burst_time;
+    runningProcess->completion_time = currentTime + currentSwitchOverhead + timeForWork(p.burst_time - p.completed_burst_time);
     lastProcessStartTime = currentTime;
 
     return runningProcess->completion_time;
@@ -46,26 +113,122 @@ int CPU::loadProcess(const Process &p, int currentTime)
 
 Process CPU::unloadProcess(int currentTime)
 {
-    Process completedProcess; 
     if (runningProcess)
     {
-        
-        runningProcess->completed_burst_time += currentTime - runningProcess->start_time;
+        int ranFor = currentTime - runningProcess->start_time;
+        int switchTime = std::min(ranFor, currentSwitchOverhead);
+        int wakeTime = std::min(ranFor, currentWakeTime);
+        int remainingWork = runningProcess->burst_time - runningProcess->completed_burst_time;
+        int work = currentTime >= runningProcess->completion_time
+                       ? remainingWork
+                       : std::min(remainingWork, static_cast<int>((ranFor - switchTime) * type.speed + 1e-9));
 
-        completedProcess = *runningProcess;
+        runningProcess->completed_burst_time += work;
+        runningProcess->cpu_time += ranFor;
+        runningProcess->last_run_end = currentTime;
+        runningProcess->last_cpu = id;
+        runningProcess->ready_time = currentTime;
+        totalSwitchTime += switchTime - wakeTime;
+        totalWakeTime += wakeTime;
+        totalWork += work;
+        idleSince = currentTime;
 
-        delete runningProcess;
-        runningProcess = nullptr;
         totalBusyTime += currentTime - lastProcessStartTime;
+
+        std::unique_ptr<Process> completedProcess = std::move(runningProcess);
+        return *completedProcess;
     }
-    else
-    {
-        throw std::runtime_error("Error: Attempting to unload a process from an empty CPU!");
-    }
-    return completedProcess;
+    throw std::runtime_error("Error: Attempting to unload a process from an empty CPU!");
 }
 
 int CPU::getTotalBusyTime() const
 {
     return totalBusyTime;
 }
+
+int CPU::getTotalSwitchTime() const
+{
+    return totalSwitchTime;
+}
+
+int CPU::getContextSwitchCount() const
+{
+    return contextSwitchCount;
+}
+
+int CPU::getWarmSwitchCount() const
+{
+    return warmSwitchCount;
+}
+
+int CPU::getTotalWakeTime() const
+{
+    return totalWakeTime;
+}
+
+long long CPU::getTotalWork() const
+{
+    return totalWork;
+}
+
+int CPU::getId() const
+{
+    return id;
+}
+
+const CoreType &CPU::getType() const
+{
+    return type;
+}
+
+int CPU::timeForWork(int work) const
+{
+    if (type.speed == 1.0)
+    {
+        return work;
+    }
+    return static_cast<int>(std::ceil(work / type.speed - 1e-9));
+}
+
+double CPU::getEnergy(int elapsedTime) const
+{
+    return type.activePower * totalBusyTime + type.idlePower * std::max(0, elapsedTime - totalBusyTime);
+}
+
+void CPU::saveState(std::ostream &out) const
+{
+    Checkpoint::write(out, runningProcess != nullptr);
+    if (runningProcess != nullptr)
+    {
+        Checkpoint::writeProcess(out, *runningProcess);
+    }
+    Checkpoint::write(out, totalBusyTime);
+    Checkpoint::write(out, lastProcessStartTime);
+    Checkpoint::write(out, currentSwitchOverhead);
+    Checkpoint::write(out, idleSince);
+    Checkpoint::write(out, currentWakeTime);
+    Checkpoint::write(out, totalSwitchTime);
+    Checkpoint::write(out, totalWakeTime);
+    Checkpoint::write(out, totalWork);
+    Checkpoint::write(out, contextSwitchCount);
+    Checkpoint::write(out, warmSwitchCount);
+}
+
+void CPU::restoreState(std::istream &in)
+{
+    runningProcess.reset();
+    if (Checkpoint::read<bool>(in))
+    {
+        runningProcess = std::make_unique<Process>(Checkpoint::readProcess(in));
+    }
+    totalBusyTime = Checkpoint::read<int>(in);
+    lastProcessStartTime = Checkpoint::read<int>(in);
+    currentSwitchOverhead = Checkpoint::read<int>(in);
+    idleSince = Checkpoint::read<int>(in);
+    currentWakeTime = Checkpoint::read<int>(in);
+    totalSwitchTime = Checkpoint::read<int>(in);
+    totalWakeTime = Checkpoint::read<int>(in);
+    totalWork = Checkpoint::read<long long>(in);
+    contextSwitchCount = Checkpoint::read<int>(in);
+    warmSwitchCount = Checkpoint::read<int>(in);
+}
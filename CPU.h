@@ -9,6 +9,46 @@
 #define CPU_H
 
 #include "Process.h" 
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Describes the speed and power draw of a type of core.
+ */
+struct CoreType
+{
+    /**
+     * @brief Units of `burst_time` completed per unit of time (1.0 is the reference core).
+     */
+    double speed = 1.0;
+
+    /**
+     * @brief Power drawn while the core is busy.
+     */
+    double activePower = 1.0;
+
+    /**
+     * @brief Power drawn while the core is idle.
+     */
+    double idlePower = 0.0;
+
+    /**
+     * @brief Parses a comma-separated list of core descriptions.
+     *
+     * Each entry has the form `[COUNTx]SPEED[:ACTIVE_POWER[:IDLE_POWER]]`, e.g. `2x2.0:8:0.4,4x1.0`.
+     * The active power defaults to `SPEED^3`, reflecting that dynamic power grows with the
+     * frequency and with the square of the voltage needed to sustain it, and the idle power
+     * defaults to 0.
+     *
+     * @param list The list to parse.
+     * @return One `CoreType` per core, in list order.
+     * @throws std::runtime_error if an entry is malformed.
+     */
+    static std::vector<CoreType> parseList(const std::string &list);
+};
 
 /**
  * @class CPU
@@ -19,6 +59,17 @@
  * - Track the currently running process
  * - Update process statistics (e.g., completion time, waiting time)
  * - Calculate and provide information about its utilization
+ * - Charge a context-switch cost whenever a process is loaded
+ *
+ * Context-switch cost model: every load costs `contextSwitchCost` time units before the
+ * process makes progress. A process that ran on this CPU within the last `cacheWarmWindow`
+ * time units still has a warm cache; every other load additionally pays `cacheMissPenalty`.
+ * Both costs default to 0, which switches processes instantly.
+ *
+ * Heterogeneous cores: a CPU completes `speed` units of `burst_time` per unit of time. An
+ * idle CPU drops to a low-power state and needs `wakeLatency` time units to return to its
+ * running frequency before the next process makes progress. Energy is the active power times
+ * the busy time plus the idle power times the idle time.
  */
 class CPU
 {
@@ -29,11 +80,26 @@ public:
     CPU();
 
     /**
-     * @brief Destructor for the CPU class.
+     * @brief Constructs a new idle CPU that charges for context switches.
      *
-     * Deallocates the memory associated with the currently running process (if any).
+     * @param contextSwitchCost Time spent on every process load before the process makes progress.
+     * @param cacheMissPenalty Additional time charged when the loaded process has a cold cache.
+     * @param cacheWarmWindow How long after leaving the CPU a process still has a warm cache.
+     * @param id The index of the CPU, used to tell whether a process last ran here.
+     * @param type The speed and power draw of the CPU.
+     * @param wakeLatency Time needed to leave the low-power idle state before a process makes progress.
+     * @throws std::runtime_error if the switch cost, cache-miss penalty, cache-warm window or wake-up latency is negative.
      */
-    ~CPU(); 
+    CPU(int contextSwitchCost, int cacheMissPenalty, int cacheWarmWindow, int id = 0,
+        const CoreType &type = CoreType(), int wakeLatency = 0);
+
+    /**
+     * @brief CPUs own their running process and are moved, never copied.
+     */
+    CPU(const CPU &) = delete;
+    CPU &operator=(const CPU &) = delete;
+    CPU(CPU &&) = default;
+    CPU &operator=(CPU &&) = default;
 
     /**
      * @brief Returns a pointer to the currently running `Process`, or `nullptr` if the CPU is idle.
@@ -52,18 +118,21 @@ public:
     /**
      * @brief Loads a process onto the CPU and calculates its expected completion time.
      *
-     * This method sets the process's `start_time` to the current time.
+     * This method sets the process's `start_time` to the current time and adds the time
+     * since the process became ready to its `wait_time`.
      *
      * @param p The `Process` object to load onto the CPU.
      * @param currentTime The current simulation time.
-     * @return The expected completion time of the process, accounting for any previously completed burst time.
+     * @return The expected completion time of the process, accounting for any previously completed burst time
+     *         and for the context-switch overhead of this load.
      */
     int loadProcess(const Process &p, int currentTime);
 
     /**
      * @brief Unloads the currently running process from the CPU.
      *
-     * This method updates the process's `completed_burst_time` and `wait_time` statistics.
+     * This method updates the process's `completed_burst_time` statistics.
+     * Time spent on the context switch does not count towards `completed_burst_time`.
      * If the CPU is empty, a `runtime_error` is thrown.
      *
      * @param currentTime The current simulation time.
@@ -74,17 +143,92 @@ public:
 
     /**
      * @brief Retrieves the total amount of time the CPU has been busy executing processes.
+     *
+     * The busy time includes time spent on context switches.
+     *
      * @return The total busy time of the CPU.
      */
     int getTotalBusyTime() const;
 
+    /**
+     * @brief Retrieves the total amount of time spent on context switches.
+     * @return The total context-switch overhead of the CPU.
+     */
+    int getTotalSwitchTime() const;
+
+    /**
+     * @brief Retrieves the number of processes loaded onto the CPU.
+     * @return The number of context switches.
+     */
+    int getContextSwitchCount() const;
+
+    /**
+     * @brief Retrieves the number of loads that found the process's cache still warm.
+     * @return The number of warm context switches.
+     */
+    int getWarmSwitchCount() const;
+
+    /**
+     * @brief Retrieves the total time spent leaving the low-power idle state.
+     * @return The total wake-up latency of the CPU.
+     */
+    int getTotalWakeTime() const;
+
+    /**
+     * @brief Retrieves the total units of `burst_time` completed by the CPU.
+     * @return The total work done.
+     */
+    long long getTotalWork() const;
+
+    /**
+     * @brief Returns the index of the CPU.
+     * @return The CPU index.
+     */
+    int getId() const;
+
+    /**
+     * @brief Returns the speed and power draw of the CPU.
+     * @return The core type of the CPU.
+     */
+    const CoreType &getType() const;
+
+    /**
+     * @brief Returns the time the CPU needs to complete an amount of work.
+     *
+     * @param work Units of `burst_time` to complete.
+     * @return The time needed, rounded up to a whole time unit.
+     */
+    int timeForWork(int work) const;
+
+    /**
+     * @brief Computes the energy consumed by the CPU over a simulation.
+     *
+     * @param elapsedTime The length of the simulation.
+     * @return The energy consumed while busy and while idle.
+     */
+    double getEnergy(int elapsedTime) const;
+
+    /**
+     * @brief Writes the running process and the counters of the CPU to a checkpoint.
+     *
+     * @param out The checkpoint stream.
+     */
+    void saveState(std::ostream &out) const;
+
+    /**
+     * @brief Restores the running process and the counters written by `saveState`.
+     *
+     * @param in The checkpoint stream.
+     */
+    void restoreState(std::istream &in);
+
 private:
     /**
-     * @brief A pointer to the currently running `Process`.
+     * @brief The currently running `Process`.
      *
-     * This will be `nullptr` if the CPU is idle.
+     * This will be null if the CPU is idle.
      */
-    Process *runningProcess = nullptr;
+    std::unique_ptr<Process> runningProcess;
 
     /**
      * @brief The total amount of time (in simulation units) that the CPU has been busy executing processes.
@@ -97,6 +241,27 @@ private:
      * This is used to calculate the duration for which the current process has been running.
      */
     int lastProcessStartTime = 0;
+
+    int contextSwitchCost = 0;   /**< @brief Time charged on every process load. */
+    int cacheMissPenalty = 0;    /**< @brief Additional time charged when the loaded process has a cold cache. */
+    int cacheWarmWindow = 0;     /**< @brief How long a process's cache stays warm after it leaves the CPU. */
+
+    /**
+     * @brief The context-switch overhead charged to the currently running process.
+     */
+    int currentSwitchOverhead = 0;
+
+    int id = 0;                  /**< @brief The index of the CPU. */
+    CoreType type;               /**< @brief The speed and power draw of the CPU. */
+    int wakeLatency = 0;         /**< @brief Time needed to leave the low-power idle state. */
+    int idleSince = 0;           /**< @brief The simulation time at which the CPU last became idle. */
+    int currentWakeTime = 0;     /**< @brief The part of `currentSwitchOverhead` spent waking up. */
+
+    int totalSwitchTime = 0;     /**< @brief Total time spent on context switches. */
+    int totalWakeTime = 0;       /**< @brief Total time spent leaving the low-power idle state. */
+    long long totalWork = 0;     /**< @brief Total units of `burst_time` completed. */
+    int contextSwitchCount = 0;  /**< @brief Number of processes loaded onto the CPU. */
+    int warmSwitchCount = 0;     /**< @brief Number of loads that found a warm cache. */
 };
 
 #endif // CPU_H
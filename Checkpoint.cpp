@@ -0,0 +1,291 @@
+#include "Checkpoint.h"
+#include "Scheduler.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Identifies checkpoint files and their format version.
+     */
+    const std::string MAGIC = "CPUSCKP1";
+
+    /**
+     * @brief Size of the blocks in which the data file is hashed.
+     */
+    constexpr size_t HASH_BLOCK_SIZE = 1 << 20;
+}
+
+Checkpoint::Checkpoint(const std::string &fileName, const std::string &algorithmType, const Options &options)
+    : fileName(fileName), algorithmType(algorithmType), options(options)
+{
+    static const std::string supported[] = {"FIFO", "SJF", "Priority", "RR", "EDF", "RM"};
+    if (std::find(std::begin(supported), std::end(supported), algorithmType) == std::end(supported))
+    {
+        throw std::runtime_error("Checkpoints are not supported for the " + algorithmType + " algorithm");
+    }
+    if (options.nodes > 0 || options.queueCapacity > 0 || options.admission != "reject" || options.memory != 0)
+    {
+        throw std::runtime_error("Checkpoints do not support clusters, admission control or memory limits");
+    }
+
+    checkpointFile = std::filesystem::path(fileName).stem().string() + "-" + algorithmType + "-checkpoint.bin";
+
+    // Everything that changes the schedule must match for a checkpoint to be reused.
+    std::ostringstream key;
+    key << algorithmType << " quantum=" << options.quantum << " preemption=" << options.preemption
+        << " switch-cost=" << options.contextSwitchCost << " cache-miss-penalty=" << options.cacheMissPenalty
+        << " cache-warm-window=" << options.cacheWarmWindow << " cpus=" << options.cores
+        << " placement=" << options.placement << " big-burst=" << options.bigBurstThreshold
+        << " wake-latency=" << options.wakeLatency;
+    fingerprint = key.str();
+}
+
+std::unique_ptr<Scheduler> Checkpoint::createScheduler()
+{
+    std::ifstream input(fileName, std::ios::binary);
+    if (!input.is_open())
+    {
+        throw std::runtime_error("Error opening file: " + fileName);
+    }
+    std::string headerLine;
+    std::getline(input, headerLine);
+    std::streampos bodyStart = input.tellg();
+    int firstProcessId = Process::nextProcessId;
+
+    Workload workload;
+    std::string state;
+    bool resumed = resume(input, headerLine, workload, state);
+    if (!resumed)
+    {
+        input.clear();
+        input.seekg(bodyStart);
+        Process::nextProcessId = firstProcessId;
+        workload = Workload::parse(headerLine, input, options.maxProcesses);
+        prefix = Prefix();
+        prefix.hash = FNV_OFFSET_BASIS;
+        prefix.nextProcessId = firstProcessId;
+    }
+    checkSupported(workload);
+
+    // The new prefix ends after the last line read; its hash continues from the old prefix's.
+    input.clear();
+    uint64_t end = static_cast<uint64_t>(input.tellg());
+    if (!hashRange(input, prefix.offset, end, prefix.hash))
+    {
+        throw std::runtime_error("Error reading file: " + fileName);
+    }
+    prefix.offset = end;
+    prefix.processes += static_cast<long long>(workload.processes.size());
+    for (const Process &p : workload.processes)
+    {
+        prefix.time = std::max(prefix.time, p.arrival_time);
+        prefix.nextProcessId = p.process_id + 1;
+    }
+
+    // The workload is already cut at the process limit.
+    Options schedulerOptions = options;
+    schedulerOptions.maxProcesses = 0;
+    auto scheduler = std::make_unique<Scheduler>(workload, algorithmType, schedulerOptions);
+    if (resumed)
+    {
+        std::istringstream saved(state);
+        scheduler->restoreState(saved);
+    }
+    scheduler->setCheckpoint(this, prefix.time);
+    return scheduler;
+}
+
+bool Checkpoint::resume(std::istream &input, const std::string &headerLine, Workload &tail, std::string &state)
+{
+    std::ifstream file(checkpointFile, std::ios::binary);
+    if (!file.is_open())
+    {
+        status = "No checkpoint found; simulating from the start";
+        return false;
+    }
+
+    std::string magic(MAGIC.size(), '\0');
+    if (!file.read(&magic[0], magic.size()) || magic != MAGIC)
+    {
+        status = checkpointFile + " is not a checkpoint; simulating from the start";
+        return false;
+    }
+    std::string savedFingerprint(read<uint32_t>(file), '\0');
+    if (!file.read(&savedFingerprint[0], savedFingerprint.size()) || savedFingerprint != fingerprint)
+    {
+        status = "The checkpoint was taken with other options; simulating from the start";
+        return false;
+    }
+
+    Prefix saved;
+    saved.offset = read<uint64_t>(file);
+    saved.hash = read<uint64_t>(file);
+    saved.processes = read<long long>(file);
+    saved.nextProcessId = read<int>(file);
+    saved.time = read<int>(file);
+
+    if (options.maxProcesses > 0 && saved.processes > options.maxProcesses)
+    {
+        status = "The process limit is below the checkpoint's; simulating from the start";
+        return false;
+    }
+    uint64_t hash = FNV_OFFSET_BASIS;
+    if (!hashRange(input, 0, saved.offset, hash) || hash != saved.hash)
+    {
+        status = "The data file no longer starts with the checkpoint's prefix; simulating from the start";
+        return false;
+    }
+
+    input.clear();
+    input.seekg(static_cast<std::streamoff>(saved.offset));
+    Process::nextProcessId = saved.nextProcessId;
+    long long remaining = options.maxProcesses > 0 ? options.maxProcesses - saved.processes : 0;
+    tail = options.maxProcesses > 0 && remaining == 0 ? Workload() : Workload::parse(headerLine, input, static_cast<int>(remaining));
+    for (const Process &p : tail.processes)
+    {
+        if (p.arrival_time < saved.time)
+        {
+            status = "Appended processes arrive before the checkpoint time " + std::to_string(saved.time) +
+                     "; simulating from the start";
+            return false;
+        }
+    }
+
+    state.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    prefix = saved;
+    status = "Resumed from " + checkpointFile + " at time " + std::to_string(saved.time) + " after " +
+             std::to_string(saved.processes) + " processes; " + std::to_string(tail.processes.size()) + " appended";
+    return true;
+}
+
+void Checkpoint::save(Scheduler &scheduler)
+{
+    // The checkpoint is replaced atomically, so an interrupted run leaves the previous one intact.
+    std::string temporaryFile = checkpointFile + ".tmp";
+    std::ofstream out(temporaryFile, std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+    {
+        throw std::runtime_error("Error opening output file: " + temporaryFile);
+    }
+
+    out.write(MAGIC.data(), MAGIC.size());
+    write<uint32_t>(out, static_cast<uint32_t>(fingerprint.size()));
+    out.write(fingerprint.data(), fingerprint.size());
+    write(out, prefix.offset);
+    write(out, prefix.hash);
+    write(out, prefix.processes);
+    write(out, prefix.nextProcessId);
+    write(out, prefix.time);
+    scheduler.saveState(out);
+
+    out.close();
+    if (!out)
+    {
+        throw std::runtime_error("Error writing output file: " + temporaryFile);
+    }
+    std::filesystem::rename(temporaryFile, checkpointFile);
+}
+
+const std::string &Checkpoint::getStatus() const
+{
+    return status;
+}
+
+void Checkpoint::writeProcess(std::ostream &out, const Process &p)
+{
+    write(out, p.process_id);
+    write(out, p.arrival_time);
+    write(out, p.burst_time);
+    write(out, p.completed_burst_time);
+    write(out, p.priority);
+    write(out, p.start_time);
+    write(out, p.completion_time);
+    write(out, p.wait_time);
+    write(out, p.turnaround_time);
+    write(out, p.response_time);
+    write(out, p.hasStarted);
+    write(out, p.last_run_end);
+    write(out, p.last_cpu);
+    write(out, p.ready_time);
+    write(out, p.phase_offset);
+    write(out, p.phase_count);
+    write(out, p.next_phase);
+    write(out, p.deadline);
+    write(out, p.period);
+    write(out, p.absolute_deadline);
+    write(out, p.tickets);
+    write(out, p.group);
+    write(out, p.pass);
+    write(out, p.cpu_time);
+    write(out, p.share_start);
+    write(out, p.share_ideal);
+}
+
+Process Checkpoint::readProcess(std::istream &in)
+{
+    Process p;
+    p.process_id = read<int>(in);
+    p.arrival_time = read<int>(in);
+    p.burst_time = read<int>(in);
+    p.completed_burst_time = read<int>(in);
+    p.priority = read<int>(in);
+    p.start_time = read<int>(in);
+    p.completion_time = read<int>(in);
+    p.wait_time = read<int>(in);
+    p.turnaround_time = read<int>(in);
+    p.response_time = read<int>(in);
+    p.hasStarted = read<bool>(in);
+    p.last_run_end = read<int>(in);
+    p.last_cpu = read<int>(in);
+    p.ready_time = read<int>(in);
+    p.phase_offset = read<int>(in);
+    p.phase_count = read<int>(in);
+    p.next_phase = read<int>(in);
+    p.deadline = read<int>(in);
+    p.period = read<int>(in);
+    p.absolute_deadline = read<int>(in);
+    p.tickets = read<int>(in);
+    p.group = read<int>(in);
+    p.pass = read<long long>(in);
+    p.cpu_time = read<int>(in);
+    p.share_start = read<double>(in);
+    p.share_ideal = read<double>(in);
+    return p;
+}
+
+bool Checkpoint::hashRange(std::istream &input, uint64_t begin, uint64_t end, uint64_t &hash)
+{
+    input.clear();
+    input.seekg(static_cast<std::streamoff>(begin));
+    std::vector<char> buffer(HASH_BLOCK_SIZE);
+    uint64_t remaining = end - begin;
+    while (remaining > 0)
+    {
+        size_t block = static_cast<size_t>(std::min<uint64_t>(remaining, buffer.size()));
+        if (!input.read(buffer.data(), block))
+        {
+            return false;
+        }
+        for (size_t i = 0; i < block; i++)
+        {
+            hash = (hash ^ static_cast<unsigned char>(buffer[i])) * FNV_PRIME;
+        }
+        remaining -= block;
+    }
+    return true;
+}
+
+void Checkpoint::checkSupported(const Workload &workload)
+{
+    bool periodic = std::any_of(workload.processes.begin(), workload.processes.end(), [](const Process &p)
+                                { return p.period > 0; });
+    if (periodic || !workload.phases.empty() || !workload.groups.empty())
+    {
+        throw std::runtime_error("Checkpoints do not support periodic tasks, I/O phases or groups");
+    }
+}
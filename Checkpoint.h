@@ -0,0 +1,167 @@
+/**
+ * @file Checkpoint.h
+ * @brief Defines the `Checkpoint` class resuming simulations of data files that are only appended to.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include "Options.h"
+#include "Process.h"
+#include "Workload.h"
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+class Scheduler;
+
+/**
+ * @class Checkpoint
+ * @brief Saves the simulation state of a data file's prefix and resumes from it once lines are appended.
+ *
+ * A checkpoint is taken when the simulation reaches the last arrival time of the processes read
+ * so far: the state at that moment does not depend on processes arriving later. It is keyed by the
+ * length of the file prefix that was read and its 64-bit FNV-1a hash, and records the options
+ * that affect the simulation. A later run whose data file still starts with that prefix, and
+ * whose new processes all arrive at or after the checkpoint time, restores the state, reads
+ * only the appended lines, and produces the same statistics as a full run.
+ *
+ * Checkpoints are written to `<data_file_stem>-<algorithm>-checkpoint.bin` in host byte order.
+ * They support the FIFO, SJF, Priority, RR, EDF, and RM algorithms, whose ready queues hold no
+ * state besides their processes, on any CPUs; periodic tasks, I/O phases, groups, admission
+ * control, memory limits, and clusters are not supported.
+ */
+class Checkpoint
+{
+public:
+    /**
+     * @brief Constructs a new `Checkpoint` object.
+     *
+     * @param fileName The data file.
+     * @param algorithmType The scheduling algorithm.
+     * @param options The simulation options.
+     * @throws std::runtime_error if the algorithm or options are not supported.
+     */
+    Checkpoint(const std::string &fileName, const std::string &algorithmType, const Options &options);
+
+    /**
+     * @brief Creates the scheduler for the data file, restored from the checkpoint if it is usable.
+     *
+     * The scheduler saves a new checkpoint through this object when its simulation reaches the
+     * last arrival time, so this object must outlive the simulation.
+     *
+     * @return The scheduler, ready to run.
+     * @throws std::runtime_error if the data file cannot be read, uses unsupported columns, or the
+     *         checkpoint is corrupt.
+     */
+    std::unique_ptr<Scheduler> createScheduler();
+
+    /**
+     * @brief Writes the checkpoint of a scheduler's current state.
+     *
+     * @param scheduler The scheduler, at the checkpoint time.
+     * @throws std::runtime_error if the checkpoint file cannot be written.
+     */
+    void save(Scheduler &scheduler);
+
+    /**
+     * @brief Describes whether the simulation resumed from the checkpoint, and why not otherwise.
+     */
+    const std::string &getStatus() const;
+
+    /**
+     * @brief Writes a value in its in-memory representation.
+     */
+    template <typename T>
+    static void write(std::ostream &out, const T &value)
+    {
+        out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    /**
+     * @brief Reads a value written by `write`.
+     *
+     * @throws std::runtime_error if the stream ends first.
+     */
+    template <typename T>
+    static T read(std::istream &in)
+    {
+        T value;
+        if (!in.read(reinterpret_cast<char *>(&value), sizeof(T)))
+        {
+            throw std::runtime_error("Truncated checkpoint");
+        }
+        return value;
+    }
+
+    /**
+     * @brief Writes every field of a process.
+     */
+    static void writeProcess(std::ostream &out, const Process &p);
+
+    /**
+     * @brief Reads a process written by `writeProcess`.
+     */
+    static Process readProcess(std::istream &in);
+
+private:
+    /**
+     * @brief The key and position of a checkpoint.
+     */
+    struct Prefix
+    {
+        uint64_t offset = 0;       /**< @brief Length of the data file prefix in bytes. */
+        uint64_t hash = 0;         /**< @brief FNV-1a hash of the prefix. */
+        long long processes = 0;   /**< @brief Number of processes in the prefix. */
+        int nextProcessId = 1;     /**< @brief Process ID of the first process after the prefix. */
+        int time = 0;              /**< @brief The checkpoint time: the last arrival time in the prefix. */
+    };
+
+    /**
+     * @brief Reads the processes appended after the checkpoint's prefix, if the checkpoint is usable.
+     *
+     * @param input The data file, positioned after the header line.
+     * @param headerLine The header line of the data file.
+     * @param tail Receives the appended processes.
+     * @param state Receives the saved scheduler state.
+     * @return True if the checkpoint is usable; otherwise `status` says why not.
+     */
+    bool resume(std::istream &input, const std::string &headerLine, Workload &tail, std::string &state);
+
+    /**
+     * @brief Updates an FNV-1a hash with the bytes [begin, end) of a stream.
+     *
+     * @return False if the stream ends before `end`.
+     */
+    static bool hashRange(std::istream &input, uint64_t begin, uint64_t end, uint64_t &hash);
+
+    /**
+     * @brief Throws if a workload uses features the checkpoint cannot save.
+     */
+    static void checkSupported(const Workload &workload);
+
+    /**
+     * @brief The FNV-1a offset basis, the hash of no bytes.
+     */
+    static constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+
+    /**
+     * @brief The 64-bit FNV prime.
+     */
+    static constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+    std::string fileName;       /**< @brief The data file. */
+    std::string algorithmType;  /**< @brief The scheduling algorithm. */
+    Options options;            /**< @brief The simulation options. */
+    std::string checkpointFile; /**< @brief The checkpoint file. */
+    std::string fingerprint;    /**< @brief The algorithm and the options that affect the simulation. */
+    Prefix prefix;              /**< @brief The prefix read by this run, saved with the new checkpoint. */
+    std::string status;         /**< @brief See `getStatus`. */
+};
+
+#endif // CHECKPOINT_H
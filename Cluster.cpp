@@ -0,0 +1,264 @@
+#include "Cluster.h"
+#include "Metrics.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+Cluster::Cluster(const Workload &workload, const std::string &algorithmType, const Options &options)
+    : algorithmType(algorithmType), routing(options.routing), networkDelay(options.networkDelay),
+      nodes(options.nodes), random(options.seed), eventQueue(EventQueue::create(options.engine))
+{
+    if (options.nodes < 1)
+    {
+        throw std::runtime_error("A cluster needs at least one node");
+    }
+    if (networkDelay < 0)
+    {
+        throw std::runtime_error("The network delay cannot be negative");
+    }
+    if (routing != "random" && routing != "round-robin" && routing != "jsq" && routing != "p2c")
+    {
+        throw std::runtime_error("Invalid routing strategy: " + routing);
+    }
+
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        nodes[i].readyQueue.reset(ReadyQueue::create(algorithmType));
+        loadIndex.insert({0, static_cast<int>(i)});
+    }
+
+    for (const Process &p : workload.processes)
+    {
+        eventQueue->push(Event(Event::ARRIVAL, p.arrival_time, p));
+    }
+}
+
+void Cluster::runSimulation()
+{
+    while (!eventQueue->empty())
+    {
+        Event currentEvent = eventQueue->top();
+        eventQueue->pop();
+
+        currentTime = currentEvent.timestamp;
+
+        switch (currentEvent.type)
+        {
+        case Event::ARRIVAL:
+            if (currentEvent.node < 0)
+            {
+                handleDispatchEvent(currentEvent);
+            }
+            else
+            {
+                handleArrivalEvent(currentEvent);
+            }
+            break;
+        case Event::COMPLETION:
+            handleCompletionEvent(currentEvent);
+            break;
+        case Event::QUANTUM_EXPIRED:
+        case Event::IO_START:
+        case Event::IO_COMPLETION:
+            break; // Nodes run every process as a single CPU burst and never schedule these events.
+        }
+    }
+}
+
+int Cluster::routeProcess()
+{
+    int count = static_cast<int>(nodes.size());
+
+    if (routing == "round-robin")
+    {
+        int node = nextNode;
+        nextNode = (nextNode + 1) % count;
+        return node;
+    }
+    if (routing == "jsq")
+    {
+        return loadIndex.begin()->second;
+    }
+
+    std::uniform_int_distribution<int> pick(0, count - 1);
+    int first = pick(random);
+    if (routing == "random" || count == 1)
+    {
+        return first;
+    }
+
+    // Power of two choices: sample a second, different node and keep the less loaded one.
+    std::uniform_int_distribution<int> pickOther(0, count - 2);
+    int second = pickOther(random);
+    if (second >= first)
+    {
+        second++;
+    }
+    return nodes[second].load < nodes[first].load ? second : first;
+}
+
+void Cluster::changeLoad(int node, int delta)
+{
+    if (routing == "jsq")
+    {
+        loadIndex.erase({nodes[node].load, node});
+        loadIndex.insert({nodes[node].load + delta, node});
+    }
+    nodes[node].load += delta;
+}
+
+void Cluster::handleDispatchEvent(const Event &arrivalEvent)
+{
+    Event routed = arrivalEvent;
+    routed.node = routeProcess();
+    changeLoad(routed.node, 1);
+
+    if (networkDelay == 0)
+    {
+        handleArrivalEvent(routed);
+    }
+    else
+    {
+        routed.timestamp = currentTime + networkDelay;
+        eventQueue->push(routed);
+    }
+}
+
+void Cluster::handleArrivalEvent(const Event &arrivalEvent)
+{
+    Node &node = nodes[arrivalEvent.node];
+
+    if (node.cpu.isIdle())
+    {
+        int completionTime = node.cpu.loadProcess(arrivalEvent.process, currentTime);
+        Event completion(Event::COMPLETION, completionTime, arrivalEvent.process);
+        completion.node = arrivalEvent.node;
+        eventQueue->push(completion);
+    }
+    else if (node.readyQueue->preempts(arrivalEvent.process, *node.cpu.getRunningProcess()))
+    {
+        Process preemptedProcess = node.cpu.unloadProcess(currentTime);
+        node.readyQueue->addProcess(preemptedProcess);
+        eventQueue->remove(EventKey(preemptedProcess.completion_time, preemptedProcess.process_id));
+
+        int completionTime = node.cpu.loadProcess(arrivalEvent.process, currentTime);
+        Event completion(Event::COMPLETION, completionTime, arrivalEvent.process);
+        completion.node = arrivalEvent.node;
+        eventQueue->push(completion);
+    }
+    else
+    {
+        node.readyQueue->addProcess(arrivalEvent.process);
+    }
+}
+
+void Cluster::handleCompletionEvent(const Event &completionEvent)
+{
+    Node &node = nodes[completionEvent.node];
+
+    if (node.cpu.isIdle() || node.cpu.getRunningProcess()->process_id != completionEvent.process.process_id)
+    {
+        return;
+    }
+
+    node.completedProcesses.push_back(node.cpu.unloadProcess(currentTime));
+    changeLoad(completionEvent.node, -1);
+
+    if (!node.readyQueue->isEmpty())
+    {
+        Process nextProcess = node.readyQueue->getNextProcess();
+        int completionTime = node.cpu.loadProcess(nextProcess, currentTime);
+        Event completion(Event::COMPLETION, completionTime, nextProcess);
+        completion.node = completionEvent.node;
+        eventQueue->push(completion);
+    }
+}
+
+void Cluster::printStatistics(const std::string &input_filename) const
+{
+    std::string filename = std::filesystem::path(input_filename).stem().string();
+    std::string outputFileName = filename + "-" + algorithmType + "-cluster-output.txt";
+    std::ofstream outputFile(outputFileName, std::ios::trunc);
+
+    if (!outputFile.is_open())
+    {
+        throw std::runtime_error("Error opening output file: " + outputFileName);
+    }
+
+    std::vector<int> responseTimes;
+    std::vector<int> turnaroundTimes;
+    long long totalWaitingTime = 0;
+    long long totalBusyTime = 0;
+    int totalElapsedTime = 0;
+
+    for (const Node &node : nodes)
+    {
+        for (const Process &p : node.completedProcesses)
+        {
+            responseTimes.push_back(p.response_time);
+            turnaroundTimes.push_back(p.completion_time - p.arrival_time);
+            totalWaitingTime += p.wait_time;
+            totalElapsedTime = std::max(totalElapsedTime, p.completion_time);
+        }
+        totalBusyTime += node.cpu.getTotalBusyTime();
+    }
+
+    int numProcesses = responseTimes.size();
+    long long totalResponseTime = 0;
+    long long totalTurnaroundTime = 0;
+    for (int i = 0; i < numProcesses; i++)
+    {
+        totalResponseTime += responseTimes[i];
+        totalTurnaroundTime += turnaroundTimes[i];
+    }
+
+    double throughput = totalElapsedTime > 0 ? static_cast<double>(numProcesses) / totalElapsedTime : 0.0;
+    double cpuUtilization = totalElapsedTime > 0 ? static_cast<double>(totalBusyTime) / (static_cast<double>(totalElapsedTime) * nodes.size()) * 100.0 : 0.0;
+    double average = numProcesses > 0 ? 1.0 / numProcesses : 0.0;
+
+    outputFile << "\n----------------- Fleet Statistics -----------------\n";
+    outputFile << "Nodes: " << nodes.size() << " (routing: " << routing << ", network delay: " << networkDelay << ")" << std::endl;
+    outputFile << "Number of processes: " << numProcesses << std::endl;
+    outputFile << "Total elapsed time (CPU burst times): " << totalElapsedTime << std::endl;
+    outputFile << "Throughput: (Number of processes executed in one unit of CPU burst time) " << throughput << std::endl;
+    outputFile << "Fleet CPU utilization: " << cpuUtilization << "%" << std::endl;
+    outputFile << "Average waiting time (CPU burst times): " << totalWaitingTime * average << std::endl;
+    outputFile << "Average turnaround time (CPU burst times): " << totalTurnaroundTime * average << std::endl;
+    outputFile << "Average response time (CPU burst times): " << totalResponseTime * average << std::endl;
+    outputFile << "Response time p50/p95/p99/max: " << percentile(responseTimes, 0.50) << " / "
+               << percentile(responseTimes, 0.95) << " / " << percentile(responseTimes, 0.99) << " / "
+               << percentile(responseTimes, 1.0) << std::endl;
+    outputFile << "Turnaround time p50/p95/p99/max: " << percentile(turnaroundTimes, 0.50) << " / "
+               << percentile(turnaroundTimes, 0.95) << " / " << percentile(turnaroundTimes, 0.99) << " / "
+               << percentile(turnaroundTimes, 1.0) << std::endl;
+    outputFile << "\n----------------- Node Statistics ------------------\n";
+    outputFile << "node processes utilization(%) avg_turnaround p99_turnaround p99_response\n";
+
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        const Node &node = nodes[i];
+        std::vector<int> nodeResponse;
+        std::vector<int> nodeTurnaround;
+        long long nodeTurnaroundTotal = 0;
+
+        for (const Process &p : node.completedProcesses)
+        {
+            nodeResponse.push_back(p.response_time);
+            nodeTurnaround.push_back(p.completion_time - p.arrival_time);
+            nodeTurnaroundTotal += p.completion_time - p.arrival_time;
+        }
+
+        double nodeUtilization = totalElapsedTime > 0 ? static_cast<double>(node.cpu.getTotalBusyTime()) / totalElapsedTime * 100.0 : 0.0;
+        double nodeAverage = nodeTurnaround.empty() ? 0.0 : static_cast<double>(nodeTurnaroundTotal) / nodeTurnaround.size();
+
+        outputFile << i << " " << node.completedProcesses.size() << " " << nodeUtilization << " " << nodeAverage << " "
+                   << percentile(nodeTurnaround, 0.99) << " " << percentile(nodeResponse, 0.99) << "\n";
+    }
+    outputFile << "----------------------------------------------------\n";
+
+    std::cout << "Statistics output to " << outputFileName << std::endl;
+
+    outputFile.close();
+}
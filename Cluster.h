@@ -0,0 +1,130 @@
+/**
+ * @file Cluster.h
+ * @brief Defines the `Cluster` class for simulating a dispatcher that routes processes to many nodes.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef CLUSTER_H
+#define CLUSTER_H
+
+#include "ReadyQueue.h"
+#include "CPU.h"
+#include "EventQueue.h"
+#include "Event.h"
+#include "Options.h"
+#include "Workload.h"
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @class Cluster
+ * @brief Simulates a front-end dispatcher in front of a fleet of single-CPU nodes.
+ *
+ * Every process arrives at the dispatcher, which routes it to one node using the
+ * configured strategy. The process reaches the node after the network delay and is
+ * then scheduled by that node's own ready queue, exactly as `Scheduler` would do.
+ *
+ * Supported routing strategies:
+ *   - "random": a uniformly random node.
+ *   - "round-robin": nodes in cyclic order.
+ *   - "jsq": join-shortest-queue, the node with the fewest queued, running or in-flight processes.
+ *   - "p2c": power-of-two-choices, the less loaded of two random nodes.
+ *
+ * All nodes share one event queue, and the loads used by join-shortest-queue are kept
+ * in an ordered index, so each event costs O(log n) regardless of the fleet size.
+ * Nodes run only the first CPU burst of multi-phase processes and release periodic tasks once.
+ */
+class Cluster
+{
+public:
+    /**
+     * @brief Constructs a new `Cluster` object.
+     *
+     * @param workload The processes to simulate.
+     * @param algorithmType The scheduling algorithm run by every node ("FIFO", "SJF", "Priority", "EDF", or "RM").
+     * @param options The simulation options (`nodes`, `routing`, `networkDelay`, and `seed` are used).
+     * @throws std::runtime_error if the node count, routing strategy or network delay is invalid.
+     */
+    Cluster(const Workload &workload, const std::string &algorithmType, const Options &options);
+
+    /**
+     * @brief Runs the simulation until every process has completed.
+     */
+    void runSimulation();
+
+    /**
+     * @brief Writes fleet-wide and per-node statistics to an output file.
+     *
+     * The statistics are written to `<data_file_stem>-<algorithm>-cluster-output.txt`.
+     * Fleet-wide and per-node tail latencies (p50, p95, p99) are reported for the
+     * response and turnaround times.
+     *
+     * @param input_filename The name of the input file used for the simulation.
+     * @throws std::runtime_error if the output file cannot be opened.
+     */
+    void printStatistics(const std::string &input_filename) const;
+
+private:
+    /**
+     * @brief A simulated node: one CPU and its own ready queue.
+     */
+    struct Node
+    {
+        CPU cpu;                                     /**< @brief The node's CPU. */
+        std::unique_ptr<ReadyQueue> readyQueue;      /**< @brief The node's ready queue. */
+        int load = 0;                                /**< @brief Processes in flight to, queued on, or running on the node. */
+        std::vector<Process> completedProcesses;     /**< @brief Processes completed by the node. */
+    };
+
+    /**
+     * @brief Picks the node that receives the next arriving process.
+     * @return The index of the chosen node.
+     */
+    int routeProcess();
+
+    /**
+     * @brief Changes the load of a node and keeps the load index up to date.
+     *
+     * @param node The index of the node.
+     * @param delta The change in load.
+     */
+    void changeLoad(int node, int delta);
+
+    /**
+     * @brief Handles a process arriving at the dispatcher.
+     *
+     * @param arrivalEvent The `Event` object representing the arrival.
+     */
+    void handleDispatchEvent(const Event &arrivalEvent);
+
+    /**
+     * @brief Handles a process reaching its node.
+     *
+     * @param arrivalEvent The `Event` object representing the arrival at the node.
+     */
+    void handleArrivalEvent(const Event &arrivalEvent);
+
+    /**
+     * @brief Handles the completion of a process on a node.
+     *
+     * @param completionEvent The `Event` object representing the completion.
+     */
+    void handleCompletionEvent(const Event &completionEvent);
+
+    int currentTime = 0;                        /**< @brief The current simulation time. */
+    std::string algorithmType;                  /**< @brief The scheduling algorithm run by every node. */
+    std::string routing;                        /**< @brief The routing strategy of the dispatcher. */
+    int networkDelay;                           /**< @brief Delay between the dispatcher and the nodes. */
+    std::vector<Node> nodes;                    /**< @brief The simulated nodes. */
+    std::set<std::pair<int, int>> loadIndex;    /**< @brief (load, node) pairs ordered by load, used by join-shortest-queue. */
+    int nextNode = 0;                           /**< @brief The next node chosen by round-robin routing. */
+    std::mt19937 random;                        /**< @brief Random source for random and power-of-two-choices routing. */
+    std::unique_ptr<EventQueue> eventQueue;     /**< @brief The event queue shared by the dispatcher and all nodes. */
+};
+
+#endif // CLUSTER_H
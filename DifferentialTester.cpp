@@ -0,0 +1,200 @@
+#include "DifferentialTester.h"
+#include <algorithm>
+#include <iostream>
+#include <random>
+
+namespace
+{
+    /**
+     * @brief Returns a value in [low, high] from the generator.
+     */
+    int uniform(std::mt19937 &random, int low, int high)
+    {
+        return std::uniform_int_distribution<int>(low, high)(random);
+    }
+
+    bool sameDispatch(const Scheduler::Dispatch &a, const Scheduler::Dispatch &b)
+    {
+        return a.time == b.time && a.cpu == b.cpu && a.processId == b.processId;
+    }
+}
+
+DifferentialTester::DifferentialTester(const std::string &algorithmType, const Options &options)
+    : algorithmType(algorithmType), options(options)
+{
+}
+
+bool DifferentialTester::run(const std::string &fileName)
+{
+    if (!compare(Workload::load(fileName, options.maxProcesses), fileName))
+    {
+        return false;
+    }
+    for (int i = 0; i < options.differential; i++)
+    {
+        if (!compare(generate(i), "random workload " + std::to_string(i) + " (seed " + std::to_string(options.seed) + ")"))
+        {
+            return false;
+        }
+    }
+
+    std::cout << "The unbatched reference and the batched multimap and heap engines agree on " << options.differential + 1
+              << " workloads (" << dispatchCount << " dispatches)" << std::endl;
+    return true;
+}
+
+DifferentialTester::Run DifferentialTester::simulate(const Workload &workload, const std::string &engine, bool stepBatching) const
+{
+    Options engineOptions = options;
+    engineOptions.engine = engine;
+    engineOptions.stepBatching = stepBatching;
+    // The data file is limited when it is loaded; the random workloads are used whole.
+    engineOptions.maxProcesses = 0;
+
+    Scheduler scheduler(workload, algorithmType, engineOptions);
+    scheduler.recordDispatches();
+    scheduler.runSimulation();
+    return Run{stepBatching ? engine : "unbatched", scheduler.getDispatches(), scheduler.getStatistics()};
+}
+
+bool DifferentialTester::compare(const Workload &workload, const std::string &name)
+{
+    // The reference handles one event at a time; both engines batch the events of a time step.
+    Run reference = simulate(workload, "multimap", false);
+    return compareRuns(workload, name, reference, simulate(workload, "multimap", true)) &&
+           compareRuns(workload, name, reference, simulate(workload, "heap", true));
+}
+
+bool DifferentialTester::compareRuns(const Workload &workload, const std::string &name, const Run &reference, const Run &candidate)
+{
+    const auto &expected = reference.dispatches;
+    const auto &actual = candidate.dispatches;
+    size_t index = 0;
+    while (index < expected.size() && index < actual.size() && sameDispatch(expected[index], actual[index]))
+    {
+        index++;
+    }
+    dispatchCount += index;
+
+    if (index < expected.size() || index < actual.size())
+    {
+        std::cout << "Runs diverge on " << name << " at dispatch " << index << " (of " << expected.size() << " "
+                  << reference.label << ", " << actual.size() << " " << candidate.label << " dispatches)" << std::endl;
+        printContext(reference.label, expected, index);
+        printContext(candidate.label, actual, index);
+
+        std::cout << "Processes involved:" << std::endl;
+        std::vector<int> involved;
+        for (const auto *dispatches : {&expected, &actual})
+        {
+            if (index < dispatches->size() && std::find(involved.begin(), involved.end(), (*dispatches)[index].processId) == involved.end())
+            {
+                involved.push_back((*dispatches)[index].processId);
+            }
+        }
+        for (int processId : involved)
+        {
+            printProcess(workload, processId);
+        }
+        return false;
+    }
+
+    const Statistics &a = reference.statistics;
+    const Statistics &b = candidate.statistics;
+    if (a.processes != b.processes || a.elapsedTime != b.elapsedTime || a.throughput != b.throughput ||
+        a.cpuUtilization != b.cpuUtilization || a.avgWaitingTime != b.avgWaitingTime ||
+        a.avgTurnaroundTime != b.avgTurnaroundTime || a.avgResponseTime != b.avgResponseTime ||
+        a.p99ResponseTime != b.p99ResponseTime || a.p99TurnaroundTime != b.p99TurnaroundTime ||
+        a.contextSwitches != b.contextSwitches)
+    {
+        std::cout << "Runs dispatch identically on " << name << " but their statistics differ:" << std::endl;
+        for (const Run *run : {&reference, &candidate})
+        {
+            const Statistics &statistics = run->statistics;
+            std::cout << "  " << run->label << ": " << statistics.processes << " processes, elapsed " << statistics.elapsedTime
+                      << ", avg turnaround " << statistics.avgTurnaroundTime << ", avg waiting " << statistics.avgWaitingTime
+                      << ", avg response " << statistics.avgResponseTime << std::endl;
+        }
+        return false;
+    }
+    return true;
+}
+
+Workload DifferentialTester::generate(int index) const
+{
+    std::mt19937 random(options.seed + static_cast<unsigned>(index));
+    Workload workload;
+    workload.groups = {"web", "batch", "tenant/a", "tenant/b"};
+
+    // Arrivals packed into a short window, and few distinct bursts and priorities, make ties common.
+    for (int i = 0; i < RANDOM_WORKLOAD_SIZE; i++)
+    {
+        Process p{i + 1, uniform(random, 0, RANDOM_WORKLOAD_SIZE / 2), uniform(random, 1, 5), uniform(random, 1, 3)};
+        p.tickets = uniform(random, 1, 4) * 25;
+        p.group = uniform(random, 0, static_cast<int>(workload.groups.size()) - 1);
+        if (uniform(random, 0, 3) == 0)
+        {
+            p.deadline = p.burst_time * uniform(random, 1, 4);
+        }
+        if (uniform(random, 0, 19) == 0)
+        {
+            p.period = uniform(random, 2, 6) * 5;
+            p.deadline = p.period;
+        }
+        if (uniform(random, 0, 9) == 0)
+        {
+            p.phase_offset = static_cast<int>(workload.phases.size());
+            int phases = uniform(random, 1, 2);
+            for (int phase = 0; phase < phases; phase++)
+            {
+                workload.phases.push_back(uniform(random, 1, 5));
+                workload.phases.push_back(uniform(random, 1, 5));
+            }
+            p.phase_count = static_cast<int>(workload.phases.size()) - p.phase_offset;
+        }
+        if (p.deadline > 0)
+        {
+            p.absolute_deadline = p.arrival_time + p.deadline;
+        }
+        p.ready_time = p.arrival_time;
+        workload.processes.push_back(p);
+    }
+    return workload;
+}
+
+void DifferentialTester::printContext(const std::string &label, const std::vector<Scheduler::Dispatch> &dispatches, size_t index)
+{
+    std::cout << "  " << label << ":" << std::endl;
+    size_t first = index > static_cast<size_t>(CONTEXT) ? index - CONTEXT : 0;
+    size_t last = std::min(dispatches.size(), index + CONTEXT + 1);
+    for (size_t i = first; i < last; i++)
+    {
+        const Scheduler::Dispatch &dispatch = dispatches[i];
+        std::cout << (i == index ? "  > " : "    ") << "#" << i << " time " << dispatch.time << " cpu " << dispatch.cpu
+                  << " process " << dispatch.processId << std::endl;
+    }
+    if (index >= dispatches.size())
+    {
+        std::cout << "  > #" << index << " (no more dispatches)" << std::endl;
+    }
+}
+
+void DifferentialTester::printProcess(const Workload &workload, int processId)
+{
+    for (const Process &p : workload.processes)
+    {
+        if (p.process_id == processId)
+        {
+            std::cout << "  process " << processId << ": arrival " << p.arrival_time << ", burst " << p.burst_time
+                      << ", priority " << p.priority << ", deadline " << p.deadline << ", period " << p.period
+                      << ", tickets " << p.tickets << ", phases " << p.phase_count / 2;
+            if (!workload.groups.empty())
+            {
+                std::cout << ", group " << workload.groups[p.group];
+            }
+            std::cout << std::endl;
+            return;
+        }
+    }
+    std::cout << "  process " << processId << ": a job released by a periodic task" << std::endl;
+}
@@ -0,0 +1,120 @@
+/**
+ * @file DifferentialTester.h
+ * @brief Defines the `DifferentialTester` class comparing the simulation engines.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef DIFFERENTIALTESTER_H
+#define DIFFERENTIALTESTER_H
+
+#include "Options.h"
+#include "Scheduler.h"
+#include "Workload.h"
+#include <string>
+#include <vector>
+
+/**
+ * @class DifferentialTester
+ * @brief Checks that an optimized engine makes exactly the same scheduling decisions as the reference.
+ *
+ * Every workload is simulated by the reference, the "multimap" event queue handling one event
+ * at a time, and then by the "multimap" and "heap" event queues handling the events of a time
+ * step together (see `Options::stepBatching`). The full dispatch sequences (time, CPU, process)
+ * and the summary statistics of each optimized run are compared with the reference. The data file is compared first, then randomly
+ * generated workloads. The random workloads are dense in ties: many processes share arrival
+ * times, bursts, and priorities, and some are periodic, multi-phase, or grouped, so that every
+ * tie-breaking rule of the event and ready queues is exercised.
+ *
+ * The first divergence is reported with the surrounding dispatches of both runs and the
+ * processes involved.
+ */
+class DifferentialTester
+{
+public:
+    /**
+     * @brief Constructs a new `DifferentialTester` object.
+     *
+     * @param algorithmType The scheduling algorithm of every run.
+     * @param options The options of every run (`differential` sets the number of random workloads,
+     *                `seed` seeds their generation; `engine` and `stepBatching` are ignored).
+     */
+    DifferentialTester(const std::string &algorithmType, const Options &options);
+
+    /**
+     * @brief Compares the runs on the data file and on the random workloads.
+     *
+     * Stops at the first workload on which a run diverges from the reference.
+     *
+     * @param fileName The name of the input file to compare first.
+     * @return True if the runs agree on every workload.
+     */
+    bool run(const std::string &fileName);
+
+private:
+    /**
+     * @brief The outcome of one run on one workload.
+     */
+    struct Run
+    {
+        std::string label;                           /**< @brief The run's name in reports ("unbatched", "multimap" or "heap"). */
+        std::vector<Scheduler::Dispatch> dispatches; /**< @brief Every dispatch, in order. */
+        Statistics statistics;                       /**< @brief The summary metrics. */
+    };
+
+    /**
+     * @brief Number of processes of each random workload.
+     */
+    static constexpr int RANDOM_WORKLOAD_SIZE = 200;
+
+    /**
+     * @brief Number of dispatches shown before and after a divergence.
+     */
+    static constexpr int CONTEXT = 3;
+
+    /**
+     * @brief Simulates a workload with the given engine, with or without step batching.
+     */
+    Run simulate(const Workload &workload, const std::string &engine, bool stepBatching) const;
+
+    /**
+     * @brief Compares the optimized runs with the reference on a workload.
+     *
+     * @param workload The workload to simulate.
+     * @param name The name of the workload in the report.
+     * @return True if every run agrees with the reference.
+     */
+    bool compare(const Workload &workload, const std::string &name);
+
+    /**
+     * @brief Compares one run with the reference and reports the first divergence.
+     *
+     * @param workload The simulated workload.
+     * @param name The name of the workload in the report.
+     * @param reference The reference run.
+     * @param candidate The run compared with it.
+     * @return True if the runs agree.
+     */
+    bool compareRuns(const Workload &workload, const std::string &name, const Run &reference, const Run &candidate);
+
+    /**
+     * @brief Generates the random workload with the given index.
+     */
+    Workload generate(int index) const;
+
+    /**
+     * @brief Prints the dispatches around `index` of one run.
+     */
+    static void printContext(const std::string &label, const std::vector<Scheduler::Dispatch> &dispatches, size_t index);
+
+    /**
+     * @brief Prints the workload entry of a process (or notes that it is a periodic job).
+     */
+    static void printProcess(const Workload &workload, int processId);
+
+    std::string algorithmType; /**< @brief The scheduling algorithm of every run. */
+    Options options;           /**< @brief The options of every run. */
+    long long dispatchCount = 0; /**< @brief Number of dispatches compared so far. */
+};
+
+#endif // DIFFERENTIALTESTER_H
@@ -0,0 +1,40 @@
+#include "EDF.h"
+#include <stdexcept>
+#include <limits>
+
+void EDF::addProcess(const Process &p)
+{
+    readyQueue.push(p);
+}
+
+void EDF::addProcesses(const std::vector<Process> &processes)
+{
+    readyQueue.pushAll(processes);
+}
+
+Process EDF::getNextProcess()
+{
+    if (readyQueue.empty())
+    {
+        throw std::runtime_error("Error: Attempting to get a process from an empty EDF queue");
+    }
+
+    Process nextProcess = readyQueue.top();
+    readyQueue.pop();
+    return nextProcess;
+}
+
+bool EDF::isEmpty() const
+{
+    return readyQueue.empty();
+}
+
+bool EDF::preempts(const Process &arriving, const Process &running) const
+{
+    return deadlineOf(arriving) < deadlineOf(running);
+}
+
+int EDF::deadlineOf(const Process &p)
+{
+    return p.absolute_deadline < 0 ? std::numeric_limits<int>::max() : p.absolute_deadline;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file EDF.h
+ * @brief Defines the EDF (Earliest Deadline First) ready queue class for a CPU scheduling simulation.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef EDF_H
+#define EDF_H
+
+#include "ReadyQueue.h"
+#include "ProcessHeap.h"
+#include <queue>
+#include <functional>
+
+/**
+ * @brief Ready queue implementation for the Earliest Deadline First (EDF) real-time scheduling algorithm.
+ *
+ * Processes are scheduled by their absolute deadline, earliest first. Processes without a
+ * deadline run only when no process with a deadline is ready. In case of a tie, the process
+ * with the earlier arrival time is prioritized.
+ *
+ * The algorithm is preemptive: a process that becomes ready with an earlier deadline than a
+ * running process takes its CPU.
+ */
+class EDF : public ReadyQueue
+{
+public:
+    /**
+     * @brief Adds a process to the EDF ready queue.
+     *
+     * @param p The Process object to be added to the queue.
+     */
+    void addProcess(const Process &p) override;
+
+    /**
+     * @brief Adds a batch of processes to the EDF ready queue, rebuilding the heap once for large batches.
+     *
+     * @param processes The Process objects to be added to the queue.
+     */
+    void addProcesses(const std::vector<Process> &processes) override;
+
+    /**
+     * @brief Retrieves and removes the process with the earliest absolute deadline.
+     *
+     * @return The Process object with the earliest deadline.
+     * @throws std::runtime_error if the queue is empty.
+     */
+    Process getNextProcess() override;
+
+    /**
+     * @brief Checks if the EDF ready queue is empty.
+     *
+     * @return True if the queue is empty, false otherwise.
+     */
+    bool isEmpty() const override;
+
+    /**
+     * @brief Checks if an arriving process has a strictly earlier deadline than the running one.
+     *
+     * @param arriving The process that became ready.
+     * @param running The process currently running on a CPU.
+     * @return True if `arriving` must complete before `running`.
+     */
+    bool preempts(const Process &arriving, const Process &running) const override;
+
+    /**
+     * @brief Returns the deadline used to order a process (processes without a deadline sort last).
+     *
+     * @param p The process.
+     * @return The absolute deadline of the process, or the largest `int` if it has none.
+     */
+    static int deadlineOf(const Process &p);
+
+private:
+    /**
+     * @brief The priority queue used to store and prioritize processes.
+     *
+     * Processes are stored in the priority queue with the following criteria:
+     *  - Highest priority: Earliest absolute deadline.
+     *  - Tiebreaker: Earliest arrival time, then lowest process ID.
+     */
+    ProcessHeap<std::function<bool(const Process &, const Process &)>> readyQueue{
+        [](const Process &p1, const Process &p2)
+        {
+            if (deadlineOf(p1) == deadlineOf(p2))
+            {
+                if (p1.arrival_time == p2.arrival_time)
+                {
+                    return p1.process_id > p2.process_id; // Then the lower process ID, so that the order is total
+                }
+                return p1.arrival_time > p2.arrival_time; // Prioritize earlier arrival if deadlines are equal
+            }
+            return deadlineOf(p1) > deadlineOf(p2); // Prioritize earlier deadline
+        }};
+};
+
+#endif // EDF_H
@@ -17,11 +17,14 @@ struct Event
     enum EventType
     {
         ARRIVAL,
-        COMPLETION
+        COMPLETION,
+        QUANTUM_EXPIRED,
+        IO_START,
+        IO_COMPLETION
     }; 
 
     /**
-     * @brief The type of the event (ARRIVAL or COMPLETION).
+     * @brief The type of the event (ARRIVAL, COMPLETION, QUANTUM_EXPIRED, IO_START or IO_COMPLETION).
      */
     EventType type;
 
@@ -36,10 +39,25 @@ struct Event
      */
     Process process;
 
+    /**
+     * @brief The cluster node the event belongs to, or -1 before the dispatcher has routed the process.
+     */
+    int node = -1;
+
+    /**
+     * @brief The CPU the event belongs to (for COMPLETION and QUANTUM_EXPIRED events).
+     */
+    int cpu = 0;
+
+    /**
+     * @brief The I/O device the event belongs to (for IO_START and IO_COMPLETION events).
+     */
+    int device = 0;
+
     /**
      * @brief Constructor for creating an Event object.
      *
-     * @param type The type of event (ARRIVAL or COMPLETION).
+     * @param type The type of event (ARRIVAL, COMPLETION, QUANTUM_EXPIRED, IO_START or IO_COMPLETION).
      * @param timestamp The timestamp at which the event occurs.
      * @param p The process associated with the event (optional, only for ARRIVAL events).
      */
@@ -8,16 +8,16 @@
 #ifndef EVENTQUEUE_H
 #define EVENTQUEUE_H
 
-#include <map>      
-#include <iostream>
+#include <string>
 #include "Event.h"
 
 /**
- * @brief Class for managing events in a CPU scheduling simulation.
+ * @brief Abstract base class for managing events in a CPU scheduling simulation.
  *
  * This class provides a priority queue-like interface for scheduling and processing
- * events in a CPU scheduling simulation. It uses a `std::multimap` to store events
- * in sorted order by their timestamp (and process ID as a tiebreaker).
+ * events in a CPU scheduling simulation. Events come out in order of their timestamp,
+ * then process ID, then insertion order. Every implementation (engine) must produce
+ * exactly this order, which the differential tester checks.
  */
 class EventQueue {
 public:
@@ -26,12 +26,26 @@ public:
      */
     using EventKey = std::pair<int, int>;
 
+    /**
+     * @brief Virtual destructor to ensure proper cleanup of derived classes.
+     */
+    virtual ~EventQueue() = default;
+
+    /**
+     * @brief Creates the event queue of an engine.
+     *
+     * @param engine The engine: "multimap" (the reference implementation) or "heap".
+     * @return A pointer to the new event queue; the caller takes ownership.
+     * @throws std::runtime_error if the engine is unknown.
+     */
+    static EventQueue* create(const std::string& engine);
+
     /**
      * @brief Adds an event to the queue.
      *
-     * @param event The event to add. The event's timestamp is used as the key in the multimap.
+     * @param event The event to add.
      */
-    void push(const Event& event);
+    virtual void push(const Event& event) = 0;
 
     /**
      * @brief Returns a const reference to the earliest (top) event in the queue.
@@ -41,42 +55,33 @@ public:
      * @return The earliest event.
      * @throws std::out_of_range if the queue is empty.
      */
-    const Event& top() const;
+    virtual const Event& top() const = 0;
 
     /**
      * @brief Removes the earliest (top) event from the queue.
      *
      * @throws std::out_of_range if the queue is empty.
      */
-    void pop();
+    virtual void pop() = 0;
 
     /**
      * @brief Checks if the queue is empty.
      *
      * @return True if the queue is empty, false otherwise.
      */
-    bool empty() const;
+    virtual bool empty() const = 0;
 
     /**
-     * @brief Removes a specific event from the queue based on its key.
+     * @brief Removes every event with the given key from the queue.
      *
      * @param key The EventKey representing the (timestamp, process_id) of the event to remove.
      */
-    void remove(const EventKey& key);
+    virtual void remove(const EventKey& key) = 0;
 
     /**
      * @brief Prints the contents of the event queue to the console for debugging purposes.
      */
-    void printQueue();
-
-private:
-    /**
-     * @brief The underlying multimap used to store events.
-     *
-     * Events are stored in sorted order by their timestamp. If two events have the same timestamp,
-     * they are ordered by their process ID.
-     */
-    std::multimap<EventKey, Event> events; 
+    virtual void printQueue() = 0;
 };
 
 #endif // EVENTQUEUE_H
@@ -0,0 +1,281 @@
+#include "GangScheduler.h"
+#include "CPU.h"
+#include "Metrics.h"
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+
+GangScheduler::GangScheduler(const Workload &workload, const std::string &algorithmType, const Options &options)
+    : algorithmType(algorithmType), eventQueue(EventQueue::create(options.engine))
+{
+    if (algorithmType != "Gang" && algorithmType != "Backfill")
+    {
+        throw std::runtime_error("Invalid gang scheduling policy: " + algorithmType);
+    }
+    if (!workload.phases.empty())
+    {
+        throw std::runtime_error("Gang scheduling does not support I/O phases");
+    }
+    if (options.nodes > 0 || options.memory != 0 || options.queueCapacity > 0 || options.admission != "reject" ||
+        options.quantum > 0 || !options.exportFile.empty() || options.timing || options.checkpoint)
+    {
+        throw std::runtime_error("Gang scheduling does not support clusters, memory limits, admission control, time "
+                                 "slices, exports, timing or checkpoints");
+    }
+
+    std::vector<CoreType> cores = options.cores.empty() ? std::vector<CoreType>(1) : CoreType::parseList(options.cores);
+    speed = cores.front().speed;
+    for (const CoreType &core : cores)
+    {
+        if (core.speed != speed)
+        {
+            throw std::runtime_error("Gang scheduling needs CPUs of one speed");
+        }
+    }
+    owners.assign(cores.size(), -1);
+    busyTimes.assign(cores.size(), 0);
+    freeCPUs = static_cast<int>(cores.size());
+
+    size_t count = workload.processes.size();
+    if (options.maxProcesses > 0)
+    {
+        count = std::min(count, static_cast<size_t>(options.maxProcesses));
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        const Process &p = workload.processes[i];
+        if (p.period > 0)
+        {
+            throw std::runtime_error("Gang scheduling does not support periodic tasks");
+        }
+        if (p.threads > freeCPUs)
+        {
+            throw std::runtime_error("Process " + std::to_string(p.process_id) + " has " + std::to_string(p.threads) +
+                                     " threads but there are only " + std::to_string(freeCPUs) + " CPUs");
+        }
+        eventQueue->push(Event(Event::ARRIVAL, p.arrival_time, p));
+    }
+}
+
+void GangScheduler::runSimulation()
+{
+    while (!eventQueue->empty())
+    {
+        int now = eventQueue->top().timestamp;
+        if (!waiting.empty())
+        {
+            fragmentedTime += static_cast<long long>(now - currentTime) * freeCPUs;
+        }
+        currentTime = now;
+
+        // Jobs that arrive or finish at the same time are all seen before the policy decides.
+        do
+        {
+            Event currentEvent = eventQueue->top();
+            eventQueue->pop();
+
+            switch (currentEvent.type)
+            {
+            case Event::ARRIVAL:
+                waiting.push_back(currentEvent.process);
+                break;
+            case Event::COMPLETION:
+                handleCompletionEvent(currentEvent);
+                break;
+            case Event::QUANTUM_EXPIRED:
+            case Event::IO_START:
+            case Event::IO_COMPLETION:
+                break; // Gangs run to completion and never schedule these events.
+            }
+        } while (!eventQueue->empty() && eventQueue->top().timestamp == currentTime);
+
+        schedule();
+    }
+}
+
+int GangScheduler::runTime(const Process &job) const
+{
+    if (speed == 1.0)
+    {
+        return job.burst_time;
+    }
+    return static_cast<int>(std::ceil(job.burst_time / speed - 1e-9));
+}
+
+void GangScheduler::startJob(Process job)
+{
+    int length = runTime(job);
+    job.start_time = currentTime;
+    job.completion_time = currentTime + length;
+    job.completed_burst_time = job.burst_time;
+    job.hasStarted = true;
+    job.cpu_time = length * job.threads;
+
+    int placed = 0;
+    for (size_t cpu = 0; placed < job.threads; cpu++)
+    {
+        if (owners[cpu] < 0)
+        {
+            if (placed == 0)
+            {
+                job.last_cpu = static_cast<int>(cpu);
+            }
+            owners[cpu] = job.process_id;
+            busyTimes[cpu] += length;
+            placed++;
+        }
+    }
+    freeCPUs -= job.threads;
+
+    runningEnds.insert({job.completion_time, job.threads});
+    eventQueue->push(Event(Event::COMPLETION, job.completion_time, job));
+    running.emplace(job.process_id, job);
+}
+
+void GangScheduler::handleCompletionEvent(const Event &completionEvent)
+{
+    auto found = running.find(completionEvent.process.process_id);
+    Process job = found->second;
+    running.erase(found);
+
+    for (int &owner : owners)
+    {
+        if (owner == job.process_id)
+        {
+            owner = -1;
+        }
+    }
+    freeCPUs += job.threads;
+    runningEnds.erase(runningEnds.find({job.completion_time, job.threads}));
+
+    job.wait_time = job.start_time - job.arrival_time;
+    job.response_time = job.wait_time;
+    job.turnaround_time = job.completion_time - job.arrival_time;
+    completedProcesses.push_back(job);
+}
+
+void GangScheduler::schedule()
+{
+    while (!waiting.empty() && waiting.front().threads <= freeCPUs)
+    {
+        startJob(waiting.front());
+        waiting.pop_front();
+    }
+
+    if (algorithmType == "Backfill" && !waiting.empty() && freeCPUs > 0)
+    {
+        backfill();
+    }
+}
+
+void GangScheduler::backfill()
+{
+    // The first waiting job is reserved the earliest time at which enough running jobs have finished.
+    const Process &head = waiting.front();
+    int available = freeCPUs;
+    int reservation = currentTime;
+    for (const auto &end : runningEnds)
+    {
+        available += end.second;
+        if (available >= head.threads)
+        {
+            reservation = end.first;
+            break;
+        }
+    }
+    // CPUs that will still be free when the reserved job starts.
+    int spare = available - head.threads;
+
+    auto job = std::next(waiting.begin());
+    while (job != waiting.end() && freeCPUs > 0)
+    {
+        bool endsInTime = currentTime + runTime(*job) <= reservation;
+        if (job->threads <= freeCPUs && (endsInTime || job->threads <= spare))
+        {
+            if (!endsInTime)
+            {
+                spare -= job->threads;
+            }
+            startJob(*job);
+            backfilledJobs++;
+            job = waiting.erase(job);
+        }
+        else
+        {
+            ++job;
+        }
+    }
+}
+
+void GangScheduler::printStatistics(const std::string &input_filename) const
+{
+    std::string filename = std::filesystem::path(input_filename).stem().string();
+    std::string outputFileName = filename + "-" + algorithmType + "-output.txt";
+    std::ofstream outputFile(outputFileName, std::ios::trunc);
+
+    if (!outputFile.is_open())
+    {
+        throw std::runtime_error("Error opening output file: " + outputFileName);
+    }
+
+    std::vector<int> waitingTimes;
+    std::vector<int> turnaroundTimes;
+    long long totalWaitingTime = 0;
+    long long totalTurnaroundTime = 0;
+    int totalElapsedTime = 0;
+    for (const Process &p : completedProcesses)
+    {
+        waitingTimes.push_back(p.wait_time);
+        turnaroundTimes.push_back(p.turnaround_time);
+        totalWaitingTime += p.wait_time;
+        totalTurnaroundTime += p.turnaround_time;
+        totalElapsedTime = std::max(totalElapsedTime, p.completion_time);
+    }
+
+    long long totalBusyTime = 0;
+    for (long long busyTime : busyTimes)
+    {
+        totalBusyTime += busyTime;
+    }
+
+    int numProcesses = completedProcesses.size();
+    double capacity = static_cast<double>(totalElapsedTime) * owners.size();
+    long long idleTime = static_cast<long long>(totalElapsedTime) * owners.size() - totalBusyTime;
+    double average = numProcesses > 0 ? 1.0 / numProcesses : 0.0;
+    double throughput = totalElapsedTime > 0 ? static_cast<double>(numProcesses) / totalElapsedTime : 0.0;
+
+    outputFile << "\n----------------- Statistics -----------------\n";
+    outputFile << "CPUs: " << owners.size() << " (policy: " << algorithmType << ")" << std::endl;
+    outputFile << "Number of processes: " << numProcesses << std::endl;
+    outputFile << "Total elapsed time (CPU burst times): " << totalElapsedTime << std::endl;
+    outputFile << "Throughput: (Number of processes executed in one unit of CPU burst time) " << throughput << std::endl;
+    outputFile << "CPU utilization: " << (capacity > 0 ? totalBusyTime / capacity * 100.0 : 0.0) << "%" << std::endl;
+    outputFile << "Idle CPU time (CPU burst times): " << idleTime << std::endl;
+    outputFile << "Fragmentation (idle CPU time while jobs waited): " << fragmentedTime << " ("
+               << (capacity > 0 ? fragmentedTime / capacity * 100.0 : 0.0) << "% of capacity)" << std::endl;
+    outputFile << "Jobs started by backfilling: " << backfilledJobs << std::endl;
+    outputFile << "Average waiting time (CPU burst times): " << totalWaitingTime * average << std::endl;
+    outputFile << "Average turnaround time (CPU burst times): " << totalTurnaroundTime * average << std::endl;
+    outputFile << "Waiting time p50/p95/p99/max: " << percentile(waitingTimes, 0.50) << " / "
+               << percentile(waitingTimes, 0.95) << " / " << percentile(waitingTimes, 0.99) << " / "
+               << percentile(waitingTimes, 1.0) << std::endl;
+    outputFile << "Turnaround time p50/p95/p99/max: " << percentile(turnaroundTimes, 0.50) << " / "
+               << percentile(turnaroundTimes, 0.95) << " / " << percentile(turnaroundTimes, 0.99) << " / "
+               << percentile(turnaroundTimes, 1.0) << std::endl;
+    outputFile << "\n------------------ CPU Statistics ------------------\n";
+    outputFile << "cpu busy_time idle_time utilization(%)\n";
+    for (size_t i = 0; i < busyTimes.size(); i++)
+    {
+        outputFile << i << " " << busyTimes[i] << " " << totalElapsedTime - busyTimes[i] << " "
+                   << (totalElapsedTime > 0 ? static_cast<double>(busyTimes[i]) / totalElapsedTime * 100.0 : 0.0) << "\n";
+    }
+    outputFile << "----------------------------------------------------\n";
+
+    std::cout << "Statistics output to " << outputFileName << std::endl;
+
+    outputFile.close();
+}
@@ -0,0 +1,118 @@
+/**
+ * @file GangScheduler.h
+ * @brief Defines the `GangScheduler` class for simulating parallel jobs whose threads run together.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef GANGSCHEDULER_H
+#define GANGSCHEDULER_H
+
+#include "EventQueue.h"
+#include "Event.h"
+#include "Options.h"
+#include "Process.h"
+#include "Workload.h"
+#include <list>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @class GangScheduler
+ * @brief Simulates gang scheduling of multi-threaded jobs on a machine with several CPUs.
+ *
+ * A job with `threads` threads only makes progress when all of them run at once, so it
+ * starts when that many CPUs are free, holds them until it completes, and runs for its
+ * burst time (scaled by the CPU speed). Jobs wait in arrival order.
+ *
+ * Supported policies:
+ *   - "Gang": strict first-come, first-served. A job that does not fit blocks the jobs
+ *     behind it, even if they would fit on the idle CPUs.
+ *   - "Backfill": EASY backfilling. The first waiting job gets a reservation at the earliest
+ *     time enough CPUs will be free, and later jobs may start on idle CPUs if they finish
+ *     before the reservation or only use CPUs the reserved job does not need. Burst times
+ *     are known exactly, so a reserved job never starts later than its reservation.
+ *
+ * Besides utilization, the statistics report the idle CPU time and the fragmentation: the
+ * part of it during which jobs were waiting, i.e. capacity lost because the waiting jobs
+ * did not fit on the idle CPUs or were not allowed to use them.
+ */
+class GangScheduler
+{
+public:
+    /**
+     * @brief Constructs a new `GangScheduler` object.
+     *
+     * @param workload The jobs to simulate.
+     * @param algorithmType The policy ("Gang" or "Backfill").
+     * @param options The simulation options (`cores`, `maxProcesses`, and `engine` are used).
+     * @throws std::runtime_error if the policy is unknown, the CPUs differ in speed, a job has
+     *         more threads than there are CPUs, the workload has periodic tasks or I/O phases, or
+     *         an option the gang scheduler does not model is set (clusters, memory limits,
+     *         admission control, time slices, exports, timing or checkpoints).
+     */
+    GangScheduler(const Workload &workload, const std::string &algorithmType, const Options &options);
+
+    /**
+     * @brief Runs the simulation until every job has completed.
+     */
+    void runSimulation();
+
+    /**
+     * @brief Writes the job and CPU statistics to `<data_file_stem>-<algorithm>-output.txt`.
+     *
+     * @param input_filename The name of the input file used for the simulation.
+     * @throws std::runtime_error if the output file cannot be opened.
+     */
+    void printStatistics(const std::string &input_filename) const;
+
+private:
+    /**
+     * @brief Starts a waiting job on the lowest-numbered free CPUs.
+     *
+     * @param job The job to start.
+     */
+    void startJob(Process job);
+
+    /**
+     * @brief Releases the CPUs of a completed job.
+     *
+     * @param completionEvent The `Event` object representing the completion.
+     */
+    void handleCompletionEvent(const Event &completionEvent);
+
+    /**
+     * @brief Starts every waiting job the policy allows to start at the current time.
+     */
+    void schedule();
+
+    /**
+     * @brief Starts the waiting jobs behind the first one that do not delay its reservation.
+     */
+    void backfill();
+
+    /**
+     * @brief Returns the time a job needs on the CPUs.
+     */
+    int runTime(const Process &job) const;
+
+    int currentTime = 0;                               /**< @brief The current simulation time. */
+    std::string algorithmType;                         /**< @brief The policy ("Gang" or "Backfill"). */
+    double speed = 1.0;                                /**< @brief The speed of every CPU. */
+    std::vector<int> owners;                           /**< @brief Process ID of the job holding each CPU, or -1 if it is idle. */
+    std::vector<long long> busyTimes;                  /**< @brief Time each CPU has spent running threads. */
+    int freeCPUs = 0;                                  /**< @brief Number of idle CPUs. */
+    std::list<Process> waiting;                        /**< @brief Jobs waiting for CPUs, in arrival order. */
+    std::unordered_map<int, Process> running;          /**< @brief Running jobs by process ID. */
+    std::multiset<std::pair<int, int>> runningEnds;    /**< @brief (completion time, threads) of every running job. */
+    std::vector<Process> completedProcesses;           /**< @brief Jobs in order of completion. */
+    long long fragmentedTime = 0;                      /**< @brief Idle CPU time during which jobs were waiting. */
+    int backfilledJobs = 0;                            /**< @brief Jobs started ahead of an earlier waiting job. */
+    std::unique_ptr<EventQueue> eventQueue;            /**< @brief Arrival and completion events. */
+};
+
+#endif // GANGSCHEDULER_H
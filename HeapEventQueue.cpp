@@ -0,0 +1,104 @@
+#include "HeapEventQueue.h"
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+void HeapEventQueue::push(const Event &event)
+{
+    int slot;
+    if (freeSlots.empty())
+    {
+        slot = static_cast<int>(slots.size());
+        slots.push_back(event);
+    }
+    else
+    {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+        slots[slot] = event;
+    }
+
+    heap.push_back(Entry{event.timestamp, event.process.process_id, nextSequence++, slot});
+    std::push_heap(heap.begin(), heap.end(), Later());
+}
+
+const Event &HeapEventQueue::top() const
+{
+    if (heap.empty())
+    {
+        throw std::out_of_range("Error: Attempting to read an event from an empty event queue!");
+    }
+    return slots[heap.front().slot];
+}
+
+void HeapEventQueue::pop()
+{
+    if (heap.empty())
+    {
+        throw std::out_of_range("Error: Attempting to pop an event from an empty event queue!");
+    }
+    popEntry();
+    discardCancelled();
+}
+
+bool HeapEventQueue::empty() const
+{
+    return heap.empty();
+}
+
+void HeapEventQueue::remove(const EventKey &key)
+{
+    cancelled[key] = nextSequence;
+    discardCancelled();
+}
+
+void HeapEventQueue::discardCancelled()
+{
+    while (!heap.empty() && !cancelled.empty())
+    {
+        const Entry &entry = heap.front();
+        EventKey key(entry.timestamp, entry.processId);
+
+        // Cancellations of keys before the top can no longer match any event.
+        while (!cancelled.empty() && cancelled.begin()->first < key)
+        {
+            cancelled.erase(cancelled.begin());
+        }
+        if (cancelled.empty() || cancelled.begin()->first != key)
+        {
+            return;
+        }
+        if (entry.sequence >= cancelled.begin()->second)
+        {
+            // Events of a key come out oldest first, so every cancelled one is gone.
+            cancelled.erase(cancelled.begin());
+            return;
+        }
+        popEntry();
+    }
+}
+
+void HeapEventQueue::popEntry()
+{
+    std::pop_heap(heap.begin(), heap.end(), Later());
+    freeSlots.push_back(heap.back().slot);
+    heap.pop_back();
+}
+
+void HeapEventQueue::printQueue()
+{
+    std::vector<Entry> ordered = heap;
+    std::sort(ordered.begin(), ordered.end(), [](const Entry &a, const Entry &b)
+              { return Later()(b, a); });
+
+    std::cout << "Event Queue:\n";
+    for (const Entry &entry : ordered)
+    {
+        auto found = cancelled.find(EventKey(entry.timestamp, entry.processId));
+        if (found != cancelled.end() && entry.sequence < found->second)
+        {
+            continue;
+        }
+        std::cout << "Time: " << entry.timestamp << " | Slot: " << entry.slot << " | Process ID: " << entry.processId << std::endl;
+    }
+}
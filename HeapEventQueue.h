@@ -0,0 +1,109 @@
+/**
+ * @file HeapEventQueue.h
+ * @brief Defines the binary-heap event queue implementation.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef HEAPEVENTQUEUE_H
+#define HEAPEVENTQUEUE_H
+
+#include "EventQueue.h"
+#include <map>
+#include <vector>
+
+/**
+ * @brief Event queue backed by a binary heap ("heap" engine).
+ *
+ * The heap holds small (timestamp, process ID, sequence number) entries, while the events
+ * themselves stay in a slot array that is reused, so sifting never copies an `Event`. The
+ * sequence number reproduces the insertion order of the reference queue for equal keys.
+ *
+ * `remove` cancels lazily: it records that the events of a key pushed so far are cancelled,
+ * and such events are dropped when they reach the top. Events of one key come out
+ * consecutively and oldest first, so a cancellation is forgotten as soon as the top moves
+ * past its stale events; the record therefore stays as small as the number of pending
+ * cancellations. Unlike the reference queue, removing a key with no events prints nothing.
+ */
+class HeapEventQueue : public EventQueue
+{
+public:
+    /**
+     * @brief Adds an event to the queue.
+     */
+    void push(const Event &event) override;
+
+    /**
+     * @brief Returns a const reference to the earliest (top) event in the queue.
+     */
+    const Event &top() const override;
+
+    /**
+     * @brief Removes the earliest (top) event from the queue.
+     */
+    void pop() override;
+
+    /**
+     * @brief Checks if the queue is empty.
+     */
+    bool empty() const override;
+
+    /**
+     * @brief Cancels every event with the given key that is currently in the queue.
+     */
+    void remove(const EventKey &key) override;
+
+    /**
+     * @brief Prints the contents of the event queue to the console for debugging purposes.
+     */
+    void printQueue() override;
+
+private:
+    /**
+     * @brief A heap entry referring to an event slot.
+     */
+    struct Entry
+    {
+        int timestamp;               /**< @brief The event's timestamp. */
+        int processId;               /**< @brief The event's process ID. */
+        unsigned long long sequence; /**< @brief Insertion number, ordering events with equal keys. */
+        int slot;                    /**< @brief Index of the event in `slots`. */
+    };
+
+    /**
+     * @brief Orders heap entries so that the earliest event is on top.
+     */
+    struct Later
+    {
+        bool operator()(const Entry &a, const Entry &b) const
+        {
+            if (a.timestamp != b.timestamp)
+            {
+                return a.timestamp > b.timestamp;
+            }
+            if (a.processId != b.processId)
+            {
+                return a.processId > b.processId;
+            }
+            return a.sequence > b.sequence;
+        }
+    };
+
+    /**
+     * @brief Drops cancelled events from the top of the heap, so that the top is always a live event.
+     */
+    void discardCancelled();
+
+    /**
+     * @brief Removes the top entry from the heap and frees its slot.
+     */
+    void popEntry();
+
+    std::vector<Entry> heap;                              /**< @brief The binary heap of entries. */
+    std::vector<Event> slots;                             /**< @brief Event storage, indexed by `Entry::slot`. */
+    std::vector<int> freeSlots;                           /**< @brief Unused indices of `slots`. */
+    std::map<EventKey, unsigned long long> cancelled;     /**< @brief Events of a key with a smaller sequence number are cancelled. */
+    unsigned long long nextSequence = 0;                  /**< @brief Sequence number of the next pushed event. */
+};
+
+#endif // HEAPEVENTQUEUE_H
@@ -0,0 +1,196 @@
+#include "HierarchicalQueue.h"
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+HierarchicalQueue::HierarchicalQueue(const std::vector<std::string> &groupNames, const Options &options)
+{
+    if (options.groupPolicy != "FIFO" && options.groupPolicy != "SJF" && options.groupPolicy != "Priority")
+    {
+        throw std::runtime_error("Invalid group policy: " + options.groupPolicy);
+    }
+
+    groups.emplace_back();
+    std::vector<std::string> names = groupNames.empty() ? std::vector<std::string>{"(all)"} : groupNames;
+
+    std::vector<int> groupNodes;
+    for (const std::string &name : names)
+    {
+        groupNodes.push_back(findOrCreate(name));
+    }
+
+    // Processes of a group that also has subgroups live in an implicit "(self)" leaf child.
+    for (int node : groupNodes)
+    {
+        int leaf = node;
+        if (!groups[node].children.empty())
+        {
+            leaf = findOrCreate(groups[node].path + "/(self)");
+        }
+        leafOfGroup.push_back(leaf);
+    }
+
+    std::stringstream entries(options.groupWeights);
+    std::string entry;
+    while (std::getline(entries, entry, ','))
+    {
+        size_t colon = entry.rfind(':');
+        double weight = 0.0;
+        try
+        {
+            weight = colon == std::string::npos ? 0.0 : std::stod(entry.substr(colon + 1));
+        }
+        catch (const std::exception &)
+        {
+        }
+        if (weight <= 0.0)
+        {
+            throw std::runtime_error("Invalid group weight: " + entry);
+        }
+
+        // Weights of groups that do not appear in the workload are ignored.
+        std::string path = entry.substr(0, colon);
+        auto group = std::find_if(groups.begin(), groups.end(), [&](const Group &g)
+                                  { return g.path == path; });
+        if (group != groups.end())
+        {
+            group->weight = weight;
+        }
+    }
+
+    for (Group &group : groups)
+    {
+        if (group.children.empty())
+        {
+            group.queue.reset(ReadyQueue::create(options.groupPolicy, options));
+        }
+    }
+}
+
+int HierarchicalQueue::findOrCreate(const std::string &path)
+{
+    int node = 0;
+    std::stringstream components(path);
+    std::string component;
+
+    while (std::getline(components, component, '/'))
+    {
+        if (component.empty())
+        {
+            continue;
+        }
+        std::string childPath = groups[node].path.empty() ? component : groups[node].path + "/" + component;
+
+        auto existing = std::find_if(groups[node].children.begin(), groups[node].children.end(), [&](int child)
+                                     { return groups[child].path == childPath; });
+        if (existing != groups[node].children.end())
+        {
+            node = *existing;
+            continue;
+        }
+
+        Group child;
+        child.path = childPath;
+        child.parent = node;
+        groups.push_back(std::move(child));
+        int index = static_cast<int>(groups.size()) - 1;
+        groups[node].children.push_back(index);
+        node = index;
+    }
+
+    return node;
+}
+
+void HierarchicalQueue::addProcess(const Process &p)
+{
+    int leaf = leafOfGroup[static_cast<size_t>(p.group) < leafOfGroup.size() ? p.group : 0];
+    groups[leaf].queue->addProcess(p);
+    if (groups[leaf].queued++ == 0)
+    {
+        activate(leaf);
+    }
+}
+
+Process HierarchicalQueue::getNextProcess()
+{
+    if (isEmpty())
+    {
+        throw std::runtime_error("Error: Attempting to get a process from an empty Group queue");
+    }
+
+    int node = 0;
+    while (!groups[node].queue)
+    {
+        Group &group = groups[node];
+        node = group.activeChildren.begin()->second;
+        group.minVruntime = std::max(group.minVruntime, groups[node].vruntime);
+    }
+
+    Process nextProcess = groups[node].queue->getNextProcess();
+    if (--groups[node].queued == 0)
+    {
+        deactivate(node);
+    }
+    return nextProcess;
+}
+
+bool HierarchicalQueue::isEmpty() const
+{
+    return groups[0].activeChildren.empty() && groups[0].queued == 0;
+}
+
+void HierarchicalQueue::chargeUsage(Process &p, int usedTime)
+{
+    int node = leafOfGroup[static_cast<size_t>(p.group) < leafOfGroup.size() ? p.group : 0];
+
+    for (; node > 0; node = groups[node].parent)
+    {
+        Group &group = groups[node];
+        std::set<std::pair<double, int>> &siblings = groups[group.parent].activeChildren;
+        if (group.active)
+        {
+            siblings.erase({group.vruntime, node});
+        }
+        group.vruntime += usedTime / group.weight;
+        if (group.active)
+        {
+            siblings.insert({group.vruntime, node});
+        }
+    }
+}
+
+void HierarchicalQueue::activate(int node)
+{
+    // Walk up while groups become active; a group that was idle cannot claim credit for that time.
+    for (; node > 0 && !groups[node].active; node = groups[node].parent)
+    {
+        Group &group = groups[node];
+        Group &parent = groups[group.parent];
+        group.vruntime = std::max(group.vruntime, parent.minVruntime);
+        group.active = true;
+
+        bool parentWasActive = !parent.activeChildren.empty();
+        parent.activeChildren.insert({group.vruntime, node});
+        if (parentWasActive)
+        {
+            break;
+        }
+    }
+}
+
+void HierarchicalQueue::deactivate(int node)
+{
+    for (; node > 0 && groups[node].active; node = groups[node].parent)
+    {
+        Group &group = groups[node];
+        Group &parent = groups[group.parent];
+        parent.activeChildren.erase({group.vruntime, node});
+        group.active = false;
+
+        if (!parent.activeChildren.empty())
+        {
+            break;
+        }
+    }
+}
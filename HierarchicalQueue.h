@@ -0,0 +1,118 @@
+/**
+ * @file HierarchicalQueue.h
+ * @brief Defines the hierarchical group (fair-share) ready queue class for a CPU scheduling simulation.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef HIERARCHICALQUEUE_H
+#define HIERARCHICALQUEUE_H
+
+#include "ReadyQueue.h"
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Ready queue implementation for hierarchical, cgroup-style fair-share scheduling.
+ *
+ * Groups form a tree given by their slash-separated paths (e.g. "tenantA/web"). Each group
+ * has a weight, and the CPU time used by its processes advances the virtual runtime of the
+ * group and of every ancestor by the time used divided by the group's weight. Starting at
+ * the root, the child with the smallest virtual runtime is chosen at every level, so siblings
+ * share the CPU in proportion to their weights. The leaf group then picks one of its own
+ * processes with its child policy (FIFO, SJF or Priority).
+ *
+ * Each group keeps its active children (those with ready processes) in an ordered set, so
+ * both selection and charging are O(depth × log n). A group whose own processes sit next to
+ * subgroups gets an implicit "(self)" child of weight 1 holding those processes.
+ */
+class HierarchicalQueue : public ReadyQueue
+{
+public:
+    /**
+     * @brief Builds the group tree.
+     *
+     * @param groupNames The group path of every group ID (an empty list puts every process in one group).
+     * @param options The simulation options (`groupPolicy` and `groupWeights` are used).
+     * @throws std::runtime_error if the child policy or a weight is invalid.
+     */
+    HierarchicalQueue(const std::vector<std::string> &groupNames, const Options &options);
+
+    /**
+     * @brief Adds a process to the queue of its group and activates the group's ancestors.
+     *
+     * @param p The Process object to be added to the queue.
+     */
+    void addProcess(const Process &p) override;
+
+    /**
+     * @brief Descends from the root through the least-served groups and takes a process from the leaf reached.
+     *
+     * @return The next Process object to run.
+     * @throws std::runtime_error if the queue is empty.
+     */
+    Process getNextProcess() override;
+
+    /**
+     * @brief Checks if no group has a ready process.
+     *
+     * @return True if the queue is empty, false otherwise.
+     */
+    bool isEmpty() const override;
+
+    /**
+     * @brief Charges the CPU time used by a process to its group and every ancestor.
+     *
+     * @param p The process that left a CPU.
+     * @param usedTime The time the process spent on the CPU.
+     */
+    void chargeUsage(Process &p, int usedTime) override;
+
+private:
+    /**
+     * @brief A group in the tree.
+     */
+    struct Group
+    {
+        std::string path;                           /**< @brief Slash-separated path of the group. */
+        int parent = -1;                            /**< @brief Index of the parent group (-1 for the root). */
+        double weight = 1.0;                        /**< @brief Share of the group relative to its siblings. */
+        double vruntime = 0.0;                      /**< @brief CPU time used by the group divided by its weight. */
+        double minVruntime = 0.0;                   /**< @brief Virtual runtime of the most recently selected child. */
+        bool active = false;                        /**< @brief Whether the group is in its parent's `activeChildren`. */
+        std::set<std::pair<double, int>> activeChildren; /**< @brief (vruntime, group) of children with ready processes. */
+        std::vector<int> children;                  /**< @brief Indices of the child groups. */
+        std::unique_ptr<ReadyQueue> queue;          /**< @brief Ready processes of a leaf group. */
+        size_t queued = 0;                          /**< @brief Number of processes in `queue`. */
+    };
+
+    /**
+     * @brief Returns the index of the group with the given path, creating it (and its ancestors) if needed.
+     *
+     * @param path The slash-separated group path.
+     * @return The index of the group.
+     */
+    int findOrCreate(const std::string &path);
+
+    /**
+     * @brief Inserts a group into its parent's active set, then its ancestors as far as needed.
+     *
+     * @param group The index of the group that got its first ready process.
+     */
+    void activate(int group);
+
+    /**
+     * @brief Removes a group from its parent's active set, then its ancestors as far as needed.
+     *
+     * @param group The index of the group that lost its last ready process.
+     */
+    void deactivate(int group);
+
+    std::vector<Group> groups;      /**< @brief All groups; index 0 is the root. */
+    std::vector<int> leafOfGroup;   /**< @brief Leaf group holding the processes of each group ID. */
+};
+
+#endif // HIERARCHICALQUEUE_H
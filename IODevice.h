@@ -0,0 +1,43 @@
+/**
+ * @file IODevice.h
+ * @brief Defines the `IODevice` structure for simulating an I/O device with its own request queue.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef IODEVICE_H
+#define IODEVICE_H
+
+#include "Process.h"
+#include <deque>
+
+/**
+ * @brief Represents an I/O device serving one request at a time in FIFO order.
+ *
+ * Processes that finish a CPU burst followed by an I/O phase wait in the device's
+ * queue, are served for the length of their I/O phase, and then become ready again.
+ */
+struct IODevice
+{
+    /**
+     * @brief Processes waiting for the device, in request order.
+     */
+    std::deque<Process> waiting;
+
+    /**
+     * @brief Whether the device is currently serving a request.
+     */
+    bool busy = false;
+
+    /**
+     * @brief Total time the device has spent serving requests.
+     */
+    long long busyTime = 0;
+
+    /**
+     * @brief Number of requests the device has served.
+     */
+    int requests = 0;
+};
+
+#endif // IODEVICE_H
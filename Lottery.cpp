@@ -0,0 +1,107 @@
+#include "Lottery.h"
+#include <algorithm>
+#include <stdexcept>
+
+Lottery::Lottery(unsigned int seed) : random(seed) {}
+
+void Lottery::addProcess(const Process &p)
+{
+    if (freeSlots.empty())
+    {
+        grow();
+    }
+
+    size_t slot = freeSlots.back();
+    freeSlots.pop_back();
+    slots[slot] = p;
+
+    long long tickets = std::max(1, p.tickets);
+    update(slot, tickets);
+    totalTickets += tickets;
+    count++;
+}
+
+Process Lottery::getNextProcess()
+{
+    if (count == 0)
+    {
+        throw std::runtime_error("Error: Attempting to get a process from an empty Lottery queue");
+    }
+
+    std::uniform_int_distribution<long long> draw(0, totalTickets - 1);
+    size_t slot = findSlot(draw(random));
+
+    Process nextProcess = slots[slot];
+    long long tickets = std::max(1, nextProcess.tickets);
+    update(slot, -tickets);
+    totalTickets -= tickets;
+    count--;
+    freeSlots.push_back(slot);
+    return nextProcess;
+}
+
+bool Lottery::isEmpty() const
+{
+    return count == 0;
+}
+
+void Lottery::update(size_t slot, long long delta)
+{
+    for (size_t i = slot + 1; i < tree.size(); i += i & (~i + 1))
+    {
+        tree[i] += delta;
+    }
+}
+
+size_t Lottery::findSlot(long long ticket) const
+{
+    // Descend the tree to the first slot whose prefix sum exceeds the ticket number.
+    size_t position = 0;
+    size_t step = 1;
+    while (step * 2 < tree.size())
+    {
+        step *= 2;
+    }
+
+    for (; step > 0; step /= 2)
+    {
+        if (position + step < tree.size() && tree[position + step] <= ticket)
+        {
+            position += step;
+            ticket -= tree[position];
+        }
+    }
+    return position;
+}
+
+void Lottery::grow()
+{
+    size_t oldSize = slots.size();
+    size_t newSize = std::max<size_t>(16, oldSize * 2);
+    slots.resize(newSize);
+
+    // Rebuild the tree in O(n) from the ticket count of every occupied slot.
+    std::vector<bool> occupied(oldSize, true);
+    for (size_t slot : freeSlots)
+    {
+        occupied[slot] = false;
+    }
+    tree.assign(newSize + 1, 0);
+    for (size_t i = 0; i < newSize; i++)
+    {
+        if (i < oldSize && occupied[i])
+        {
+            tree[i + 1] += std::max(1, slots[i].tickets);
+        }
+        size_t parent = (i + 1) + ((i + 1) & (~(i + 1) + 1));
+        if (parent <= newSize)
+        {
+            tree[parent] += tree[i + 1];
+        }
+    }
+
+    for (size_t slot = newSize; slot > oldSize; slot--)
+    {
+        freeSlots.push_back(slot - 1);
+    }
+}
@@ -0,0 +1,87 @@
+/**
+ * @file Lottery.h
+ * @brief Defines the Lottery proportional-share ready queue class for a CPU scheduling simulation.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef LOTTERY_H
+#define LOTTERY_H
+
+#include "ReadyQueue.h"
+#include <random>
+#include <vector>
+
+/**
+ * @brief Ready queue implementation for lottery scheduling, a randomized proportional-share algorithm.
+ *
+ * Each selection draws a random ticket among all tickets held by ready processes, so a
+ * process is selected with a probability proportional to its tickets.
+ *
+ * Ready processes occupy slots whose ticket counts are kept in a Fenwick (binary indexed)
+ * tree, so adding a process, drawing the winning ticket and removing the winner are all
+ * O(log n). Freed slots are reused; the tree doubles (and is rebuilt in O(n)) when full.
+ */
+class Lottery : public ReadyQueue
+{
+public:
+    /**
+     * @brief Constructs an empty lottery ready queue.
+     *
+     * @param seed Seed for the random ticket draws.
+     */
+    explicit Lottery(unsigned int seed);
+
+    /**
+     * @brief Adds a process to the lottery ready queue.
+     *
+     * @param p The Process object to be added to the queue.
+     */
+    void addProcess(const Process &p) override;
+
+    /**
+     * @brief Draws a ticket and removes the process holding it.
+     *
+     * @return The Process object holding the winning ticket.
+     * @throws std::runtime_error if the queue is empty.
+     */
+    Process getNextProcess() override;
+
+    /**
+     * @brief Checks if the lottery ready queue is empty.
+     *
+     * @return True if the queue is empty, false otherwise.
+     */
+    bool isEmpty() const override;
+
+private:
+    /**
+     * @brief Adds `delta` tickets to a slot in the Fenwick tree.
+     *
+     * @param slot The zero-based slot index.
+     * @param delta The change in tickets.
+     */
+    void update(size_t slot, long long delta);
+
+    /**
+     * @brief Finds the slot holding a ticket.
+     *
+     * @param ticket A zero-based ticket number smaller than the total ticket count.
+     * @return The zero-based slot index holding the ticket.
+     */
+    size_t findSlot(long long ticket) const;
+
+    /**
+     * @brief Doubles the number of slots and rebuilds the Fenwick tree.
+     */
+    void grow();
+
+    std::vector<Process> slots;          /**< @brief Ready processes, indexed by slot. */
+    std::vector<long long> tree;         /**< @brief One-based Fenwick tree over slot tickets. */
+    std::vector<size_t> freeSlots;       /**< @brief Slots not holding a process. */
+    long long totalTickets = 0;          /**< @brief Sum of the tickets of all ready processes. */
+    size_t count = 0;                    /**< @brief Number of ready processes. */
+    std::mt19937_64 random;              /**< @brief Random source for ticket draws. */
+};
+
+#endif // LOTTERY_H
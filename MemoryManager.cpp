@@ -0,0 +1,182 @@
+#include "MemoryManager.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+MemoryManager::MemoryManager(const Options &options, int cpuCount)
+    : capacity(options.memory), policy(options.memoryPolicy), cpuCount(cpuCount)
+{
+    if (capacity <= 0)
+    {
+        throw std::runtime_error("The memory capacity must be positive");
+    }
+    if (policy != "fifo" && policy != "best-fit" && policy != "drf")
+    {
+        throw std::runtime_error("Invalid memory policy: " + policy);
+    }
+}
+
+int MemoryManager::getCapacity() const
+{
+    return capacity;
+}
+
+const std::string &MemoryManager::getPolicy() const
+{
+    return policy;
+}
+
+std::vector<Process> MemoryManager::request(const Process &p, int currentTime)
+{
+    if (p.memory > capacity)
+    {
+        throw std::runtime_error("Process " + std::to_string(p.process_id) + " needs " + std::to_string(p.memory) +
+                                 " memory but the capacity is " + std::to_string(capacity));
+    }
+
+    WaitKey key(p.memory, sequence++);
+    if (policy == "fifo")
+    {
+        arrivalOrder.push_back(p);
+    }
+    else if (policy == "best-fit")
+    {
+        byDemand.emplace(key, p);
+    }
+    else
+    {
+        Group &group = groupOf(p.group);
+        if (group.waiting.empty())
+        {
+            groupOrder.insert({dominantShare(group), p.group});
+        }
+        group.waiting.emplace(key, p);
+    }
+
+    std::vector<Process> admitted;
+    admitWaiting(currentTime, admitted);
+    return admitted;
+}
+
+std::vector<Process> MemoryManager::release(const Process &p, int currentTime)
+{
+    accumulate(currentTime);
+    used -= p.memory;
+    if (policy == "drf")
+    {
+        Group &group = groups[p.group];
+        bool listed = !group.waiting.empty();
+        if (listed)
+        {
+            groupOrder.erase({dominantShare(group), p.group});
+        }
+        group.admitted--;
+        group.memory -= p.memory;
+        if (listed)
+        {
+            groupOrder.insert({dominantShare(group), p.group});
+        }
+    }
+
+    std::vector<Process> admitted;
+    admitWaiting(currentTime, admitted);
+    return admitted;
+}
+
+long long MemoryManager::getPeakUsage() const
+{
+    return peak;
+}
+
+long long MemoryManager::getUsageTime(int time) const
+{
+    return usageTime + used * (time - lastChange);
+}
+
+void MemoryManager::admitWaiting(int currentTime, std::vector<Process> &admitted)
+{
+    long long free = capacity - used;
+
+    if (policy == "fifo")
+    {
+        while (!arrivalOrder.empty() && arrivalOrder.front().memory <= free)
+        {
+            free -= arrivalOrder.front().memory;
+            admit(arrivalOrder.front(), currentTime, admitted);
+            arrivalOrder.pop_front();
+        }
+        return;
+    }
+
+    if (policy == "best-fit")
+    {
+        while (!byDemand.empty() && byDemand.begin()->first.first <= free)
+        {
+            // The largest demand that fits, and the earliest arrival among equal demands.
+            auto largest = std::prev(byDemand.upper_bound(WaitKey(static_cast<int>(free), std::numeric_limits<long long>::max())));
+            auto chosen = byDemand.lower_bound(WaitKey(largest->first.first, 0));
+            free -= chosen->first.first;
+            admit(chosen->second, currentTime, admitted);
+            byDemand.erase(chosen);
+        }
+        return;
+    }
+
+    bool progress = true;
+    while (progress)
+    {
+        progress = false;
+        for (auto entry = groupOrder.begin(); entry != groupOrder.end(); ++entry)
+        {
+            Group &group = groups[entry->second];
+            auto smallest = group.waiting.begin();
+            if (smallest->first.first > free)
+            {
+                continue;
+            }
+
+            int id = entry->second;
+            groupOrder.erase(entry);
+            free -= smallest->first.first;
+            group.admitted++;
+            group.memory += smallest->first.first;
+            admit(smallest->second, currentTime, admitted);
+            group.waiting.erase(smallest);
+            if (!group.waiting.empty())
+            {
+                groupOrder.insert({dominantShare(group), id});
+            }
+            progress = true;
+            break;
+        }
+    }
+}
+
+void MemoryManager::admit(Process p, int currentTime, std::vector<Process> &admitted)
+{
+    accumulate(currentTime);
+    used += p.memory;
+    peak = std::max(peak, used);
+    p.memory_wait = currentTime - p.arrival_time;
+    admitted.push_back(p);
+}
+
+double MemoryManager::dominantShare(const Group &group) const
+{
+    return std::max(static_cast<double>(group.admitted) / cpuCount, static_cast<double>(group.memory) / capacity);
+}
+
+MemoryManager::Group &MemoryManager::groupOf(int group)
+{
+    if (group >= static_cast<int>(groups.size()))
+    {
+        groups.resize(group + 1);
+    }
+    return groups[group];
+}
+
+void MemoryManager::accumulate(int currentTime)
+{
+    usageTime += used * (currentTime - lastChange);
+    lastChange = currentTime;
+}
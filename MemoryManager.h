@@ -0,0 +1,150 @@
+/**
+ * @file MemoryManager.h
+ * @brief Defines the `MemoryManager` class admitting processes into a machine of limited memory.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef MEMORYMANAGER_H
+#define MEMORYMANAGER_H
+
+#include "Options.h"
+#include "Process.h"
+#include <deque>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @class MemoryManager
+ * @brief Holds arriving processes until their memory demand fits into the machine's free memory.
+ *
+ * A process is admitted once its `memory` demand fits into the free memory, keeps the memory
+ * while it is ready, running or doing I/O, and releases it when it completes. Until then it is
+ * blocked on memory, even if a CPU is idle.
+ *
+ * Admission policies, applied whenever memory is requested or released:
+ *   - "fifo": processes are admitted in arrival order; one that does not fit blocks the rest.
+ *   - "best-fit": the waiting process with the largest demand that fits is admitted first
+ *     (earliest arrival among equal demands), leaving the least memory unused.
+ *   - "drf": dominant resource fairness between groups. A group's dominant share is the larger
+ *     of its admitted processes' share of the CPUs (one CPU each) and its share of the memory;
+ *     the group with the lowest dominant share whose smallest waiting demand fits is served,
+ *     smallest demand first. Without a Group column all processes share one group.
+ *
+ * Waiting processes are indexed by memory demand, so each admission costs O(log n) with n
+ * processes waiting ("drf" additionally scans the groups in share order).
+ */
+class MemoryManager
+{
+public:
+    /**
+     * @brief Constructs a new `MemoryManager` object.
+     *
+     * @param options The simulation options (`memory` and `memoryPolicy` are used).
+     * @param cpuCount The number of CPUs of the machine, used for dominant shares.
+     * @throws std::runtime_error if the capacity is not positive or the policy is unknown.
+     */
+    MemoryManager(const Options &options, int cpuCount);
+
+    /**
+     * @brief Returns the machine's memory capacity.
+     */
+    int getCapacity() const;
+
+    /**
+     * @brief Returns the admission policy.
+     */
+    const std::string &getPolicy() const;
+
+    /**
+     * @brief Adds an arriving process to the waiting processes and admits every process that fits.
+     *
+     * @param p The arriving process.
+     * @param currentTime The current simulation time.
+     * @return The admitted processes, in admission order, with `memory_wait` set.
+     */
+    std::vector<Process> request(const Process &p, int currentTime);
+
+    /**
+     * @brief Releases the memory of a completed process and admits every process that now fits.
+     *
+     * @param p The completed process.
+     * @param currentTime The current simulation time.
+     * @return The admitted processes, in admission order, with `memory_wait` set.
+     */
+    std::vector<Process> release(const Process &p, int currentTime);
+
+    /**
+     * @brief Returns the largest amount of memory in use at any time.
+     */
+    long long getPeakUsage() const;
+
+    /**
+     * @brief Returns the integral of the memory in use over time, up to a given time.
+     *
+     * @param time A time no earlier than the last request or release.
+     */
+    long long getUsageTime(int time) const;
+
+private:
+    /**
+     * @brief Position of a waiting process in the demand index: (memory demand, arrival sequence).
+     */
+    using WaitKey = std::pair<int, long long>;
+
+    /**
+     * @brief Admission state of one group under "drf".
+     */
+    struct Group
+    {
+        std::map<WaitKey, Process> waiting; /**< @brief Waiting processes by demand. */
+        int admitted = 0;                   /**< @brief Admitted processes that have not completed. */
+        long long memory = 0;               /**< @brief Memory held by the admitted processes. */
+    };
+
+    /**
+     * @brief Admits waiting processes under the policy for as long as one fits.
+     *
+     * @param currentTime The current simulation time.
+     * @param admitted Receives the admitted processes.
+     */
+    void admitWaiting(int currentTime, std::vector<Process> &admitted);
+
+    /**
+     * @brief Gives a process its memory.
+     */
+    void admit(Process p, int currentTime, std::vector<Process> &admitted);
+
+    /**
+     * @brief Returns a group's dominant share of the CPUs and memory.
+     */
+    double dominantShare(const Group &group) const;
+
+    /**
+     * @brief Returns the state of a group, creating it if needed.
+     */
+    Group &groupOf(int group);
+
+    /**
+     * @brief Adds the memory in use since the last change to `usageTime`.
+     */
+    void accumulate(int currentTime);
+
+    int capacity;                                /**< @brief The machine's memory. */
+    std::string policy;                          /**< @brief The admission policy. */
+    int cpuCount;                                /**< @brief The machine's CPUs. */
+    long long used = 0;                          /**< @brief Memory held by admitted processes. */
+    long long peak = 0;                          /**< @brief Largest value of `used`. */
+    long long usageTime = 0;                     /**< @brief Integral of `used` over time up to `lastChange`. */
+    int lastChange = 0;                          /**< @brief Time of the last change of `used`. */
+    long long sequence = 0;                      /**< @brief Arrival sequence number given to the next waiting process. */
+    std::deque<Process> arrivalOrder;            /**< @brief Waiting processes in arrival order ("fifo"). */
+    std::map<WaitKey, Process> byDemand;         /**< @brief Waiting processes by demand ("best-fit"). */
+    std::vector<Group> groups;                   /**< @brief Admission state of every group ("drf"). */
+    std::set<std::pair<double, int>> groupOrder; /**< @brief (dominant share, group) of the groups with waiting processes ("drf"). */
+};
+
+#endif // MEMORYMANAGER_H
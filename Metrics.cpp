@@ -0,0 +1,16 @@
+#include "Metrics.h"
+#include <algorithm>
+#include <cmath>
+
+int percentile(std::vector<int> &values, double fraction)
+{
+    if (values.empty())
+    {
+        return 0;
+    }
+
+    size_t rank = static_cast<size_t>(std::ceil(fraction * values.size()));
+    size_t index = rank == 0 ? 0 : std::min(rank - 1, values.size() - 1);
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
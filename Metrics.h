@@ -0,0 +1,41 @@
+/**
+ * @file Metrics.h
+ * @brief Declares helper functions for summarizing per-process measurements.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <vector>
+
+/**
+ * @brief Summary metrics of one simulation run.
+ */
+struct Statistics
+{
+    int processes = 0;              /**< @brief Number of completed processes. */
+    int elapsedTime = 0;            /**< @brief Completion time of the last process. */
+    double throughput = 0.0;        /**< @brief Processes completed per time unit. */
+    double cpuUtilization = 0.0;    /**< @brief Busy time over the capacity of all CPUs (%). */
+    double avgWaitingTime = 0.0;    /**< @brief Average time spent in the ready queue. */
+    double avgTurnaroundTime = 0.0; /**< @brief Average completion time minus arrival time. */
+    double avgResponseTime = 0.0;   /**< @brief Average time from arrival to first progress on a CPU. */
+    int p99ResponseTime = 0;        /**< @brief 99th percentile of the response time. */
+    int p99TurnaroundTime = 0;      /**< @brief 99th percentile of the turnaround time. */
+    int contextSwitches = 0;        /**< @brief Number of process loads over all CPUs. */
+};
+
+/**
+ * @brief Returns the nearest-rank percentile of a set of values.
+ *
+ * The values are partially reordered in place, which avoids sorting the whole set.
+ *
+ * @param values The values to summarize.
+ * @param fraction The requested percentile as a fraction (e.g. 0.99 for p99).
+ * @return The percentile value, or 0 if `values` is empty.
+ */
+int percentile(std::vector<int> &values, double fraction);
+
+#endif // METRICS_H
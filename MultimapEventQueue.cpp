@@ -0,0 +1,53 @@
+#include "MultimapEventQueue.h"
+#include <iostream>
+
+void MultimapEventQueue::push(const Event& event){
+    EventKey eventKey(event.timestamp, event.process.process_id);
+    events.insert({eventKey, event});
+}
+
+const Event& MultimapEventQueue::top() const {
+    return events.begin()->second;
+}
+
+void MultimapEventQueue::pop(){
+    events.erase(events.begin());
+}
+
+bool MultimapEventQueue::empty() const {
+    return events.empty();
+}
+
+void MultimapEventQueue::remove(const EventKey& key) {
+    int elementsRemoved = events.erase(key);
+    if(elementsRemoved == 0){
+        std::cout << "Event Not Found\n";
+    }
+}
+
+void MultimapEventQueue::printQueue() {
+    std::cout << "Event Queue:\n";
+    for (const auto& [key, event] : events) { 
+        std::cout << "Time: " << event.timestamp << " ";
+        std::cout << "| Type: ";
+        switch (event.type)
+        {
+        case Event::ARRIVAL:
+            std::cout << "Arrival ";
+            break;
+        case Event::COMPLETION:
+            std::cout << "Completion ";
+            break;
+        case Event::QUANTUM_EXPIRED:
+            std::cout << "Quantum ";
+            break;
+        case Event::IO_START:
+            std::cout << "I/O Start ";
+            break;
+        case Event::IO_COMPLETION:
+            std::cout << "I/O Completion ";
+            break;
+        }
+        std::cout << "| Process ID: " << event.process.process_id << std::endl;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+/**
+ * @file MultimapEventQueue.h
+ * @brief Defines the reference event queue implementation backed by a `std::multimap`.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef MULTIMAPEVENTQUEUE_H
+#define MULTIMAPEVENTQUEUE_H
+
+#include <map>
+#include <iostream>
+#include "EventQueue.h"
+
+/**
+ * @brief Reference event queue ("multimap" engine).
+ *
+ * It uses a `std::multimap` to store events in sorted order by their timestamp
+ * (and process ID as a tiebreaker); events with equal keys keep their insertion order.
+ */
+class MultimapEventQueue : public EventQueue {
+public:
+    /**
+     * @brief Adds an event to the queue. The event's timestamp and process ID are used as the key in the multimap.
+     */
+    void push(const Event& event) override;
+
+    /**
+     * @brief Returns a const reference to the earliest (top) event in the queue.
+     */
+    const Event& top() const override;
+
+    /**
+     * @brief Removes the earliest (top) event from the queue.
+     */
+    void pop() override;
+
+    /**
+     * @brief Checks if the queue is empty.
+     */
+    bool empty() const override;
+
+    /**
+     * @brief Removes every event with the given key, printing a message if there is none.
+     */
+    void remove(const EventKey& key) override;
+
+    /**
+     * @brief Prints the contents of the event queue to the console for debugging purposes.
+     */
+    void printQueue() override;
+
+private:
+    /**
+     * @brief The underlying multimap used to store events.
+     *
+     * Events are stored in sorted order by their timestamp. If two events have the same timestamp,
+     * they are ordered by their process ID.
+     */
+    std::multimap<EventKey, Event> events; 
+};
+
+#endif // MULTIMAPEVENTQUEUE_H
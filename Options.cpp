@@ -0,0 +1,250 @@
+#include "Options.h"
+#include <stdexcept>
+
+namespace
+{
+    int parseInt(const std::string &name, const std::string &value)
+    {
+        try
+        {
+            size_t used = 0;
+            int result = std::stoi(value, &used);
+            if (used == value.size())
+            {
+                return result;
+            }
+        }
+        catch (const std::exception &)
+        {
+        }
+        throw std::runtime_error("Invalid value for --" + name + ": " + value);
+    }
+
+    double parseDouble(const std::string &name, const std::string &value)
+    {
+        try
+        {
+            size_t used = 0;
+            double result = std::stod(value, &used);
+            if (used == value.size())
+            {
+                return result;
+            }
+        }
+        catch (const std::exception &)
+        {
+        }
+        throw std::runtime_error("Invalid value for --" + name + ": " + value);
+    }
+
+    bool parseBool(const std::string &name, const std::string &value)
+    {
+        if (value == "on" || value == "1" || value == "true")
+        {
+            return true;
+        }
+        if (value == "off" || value == "0" || value == "false")
+        {
+            return false;
+        }
+        throw std::runtime_error("Invalid value for --" + name + ": " + value);
+    }
+}
+
+Options Options::parse(int argc, char *argv[], int first)
+{
+    Options options;
+
+    for (int i = first; i < argc; i++)
+    {
+        options.apply(argv[i]);
+    }
+
+    return options;
+}
+
+void Options::apply(const std::string &arg)
+{
+    size_t equals = arg.find('=');
+    if (arg.compare(0, 2, "--") != 0 || equals == std::string::npos)
+    {
+        throw std::runtime_error("Invalid option (expected --name=value): " + arg);
+    }
+
+    std::string name = arg.substr(2, equals - 2);
+    std::string value = arg.substr(equals + 1);
+
+    set(name, value);
+}
+
+void Options::set(const std::string &name, const std::string &value)
+{
+    if (name == "max-processes")
+    {
+        maxProcesses = parseInt(name, value);
+    }
+    else if (name == "nodes")
+    {
+        nodes = parseInt(name, value);
+    }
+    else if (name == "routing")
+    {
+        routing = value;
+    }
+    else if (name == "network-delay")
+    {
+        networkDelay = parseInt(name, value);
+    }
+    else if (name == "seed")
+    {
+        seed = static_cast<unsigned int>(parseInt(name, value));
+    }
+    else if (name == "quantum")
+    {
+        quantum = parseInt(name, value);
+    }
+    else if (name == "quantum-percentile")
+    {
+        quantumPercentile = parseDouble(name, value);
+    }
+    else if (name == "retune-interval")
+    {
+        retuneInterval = parseInt(name, value);
+    }
+    else if (name == "preemption")
+    {
+        preemption = parseBool(name, value);
+    }
+    else if (name == "switch-cost")
+    {
+        contextSwitchCost = parseInt(name, value);
+    }
+    else if (name == "cache-miss-penalty")
+    {
+        cacheMissPenalty = parseInt(name, value);
+    }
+    else if (name == "cache-warm-window")
+    {
+        cacheWarmWindow = parseInt(name, value);
+    }
+    else if (name == "cpus")
+    {
+        cores = value;
+    }
+    else if (name == "placement")
+    {
+        placement = value;
+    }
+    else if (name == "big-burst")
+    {
+        bigBurstThreshold = parseInt(name, value);
+    }
+    else if (name == "wake-latency")
+    {
+        wakeLatency = parseInt(name, value);
+    }
+    else if (name == "io-devices")
+    {
+        ioDevices = parseInt(name, value);
+    }
+    else if (name == "horizon")
+    {
+        horizon = parseInt(name, value);
+    }
+    else if (name == "queue-capacity")
+    {
+        queueCapacity = parseInt(name, value);
+    }
+    else if (name == "admission")
+    {
+        admission = value;
+    }
+    else if (name == "token-rate")
+    {
+        tokenRate = parseDouble(name, value);
+    }
+    else if (name == "token-burst")
+    {
+        tokenBurst = parseDouble(name, value);
+    }
+    else if (name == "memory")
+    {
+        memory = parseInt(name, value);
+    }
+    else if (name == "memory-policy")
+    {
+        memoryPolicy = value;
+    }
+    else if (name == "export")
+    {
+        exportFile = value;
+    }
+    else if (name == "export-format")
+    {
+        exportFormat = value;
+    }
+    else if (name == "timing")
+    {
+        timing = parseBool(name, value);
+    }
+    else if (name == "input-format")
+    {
+        inputFormat = value;
+    }
+    else if (name == "trace-unit")
+    {
+        traceUnit = parseInt(name, value);
+    }
+    else if (name == "tune")
+    {
+        tune = value;
+    }
+    else if (name == "tune-space")
+    {
+        tuneSpace = value;
+    }
+    else if (name == "tune-metric")
+    {
+        tuneMetric = value;
+    }
+    else if (name == "tune-samples")
+    {
+        tuneSamples = parseInt(name, value);
+    }
+    else if (name == "threads")
+    {
+        threads = parseInt(name, value);
+    }
+    else if (name == "engine")
+    {
+        engine = value;
+    }
+    else if (name == "step-batching")
+    {
+        stepBatching = parseBool(name, value);
+    }
+    else if (name == "differential")
+    {
+        differential = parseInt(name, value);
+    }
+    else if (name == "cache-size")
+    {
+        cacheSize = parseInt(name, value);
+    }
+    else if (name == "checkpoint")
+    {
+        checkpoint = parseBool(name, value);
+    }
+    else if (name == "group-policy")
+    {
+        groupPolicy = value;
+    }
+    else if (name == "group-weights")
+    {
+        groupWeights = value;
+    }
+    else
+    {
+        throw std::runtime_error("Unknown option: --" + name);
+    }
+}
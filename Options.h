@@ -0,0 +1,263 @@
+/**
+ * @file Options.h
+ * @brief Defines the `Options` structure holding the optional command-line settings of the simulator.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef OPTIONS_H
+#define OPTIONS_H
+
+#include <string>
+
+/**
+ * @brief Optional settings passed to the simulator as `--name=value` arguments.
+ *
+ * Every field has a default that reproduces the behavior of a plain
+ * `scheduler_simulator <data_file> <algorithm>` invocation.
+ */
+struct Options
+{
+    /**
+     * @brief Maximum number of processes read from the input file (0 means no limit).
+     */
+    int maxProcesses = 500;
+
+    /**
+     * @brief Number of simulated nodes behind the dispatcher (0 runs the single-CPU simulation).
+     */
+    int nodes = 0;
+
+    /**
+     * @brief Strategy used by the dispatcher to route arrivals to nodes
+     *        ("random", "round-robin", "jsq" or "p2c").
+     */
+    std::string routing = "round-robin";
+
+    /**
+     * @brief Delay between a process arriving at the dispatcher and reaching its node.
+     */
+    int networkDelay = 0;
+
+    /**
+     * @brief Seed for every random choice made by the simulation.
+     */
+    unsigned int seed = 1;
+
+    /**
+     * @brief Time slice after which the running process is moved back to the ready queue (0 disables time slicing).
+     */
+    int quantum = 0;
+
+    /**
+     * @brief Percentile of completed CPU burst lengths that "AdaptiveRR" sets the quantum to.
+     */
+    double quantumPercentile = 80.0;
+
+    /**
+     * @brief Number of completed CPU bursts after which "AdaptiveRR" retunes the quantum.
+     */
+    int retuneInterval = 100;
+
+    /**
+     * @brief Whether preemptive algorithms ("Priority", "EDF", "RM") may preempt a running process.
+     */
+    bool preemption = true;
+
+    /**
+     * @brief Time charged on every process load before the process makes progress.
+     */
+    int contextSwitchCost = 0;
+
+    /**
+     * @brief Additional time charged when the loaded process has a cold cache.
+     */
+    int cacheMissPenalty = 0;
+
+    /**
+     * @brief How long after leaving the CPU a process still has a warm cache.
+     */
+    int cacheWarmWindow = 0;
+
+    /**
+     * @brief Comma-separated core descriptions (see `CoreType::parseList`); empty means one reference CPU.
+     */
+    std::string cores;
+
+    /**
+     * @brief Policy choosing among idle CPUs ("first", "fastest" or "size").
+     */
+    std::string placement = "first";
+
+    /**
+     * @brief Remaining burst from which the "size" placement steers a process to the fastest idle CPU.
+     */
+    int bigBurstThreshold = 10;
+
+    /**
+     * @brief Time an idle CPU needs to return to its running frequency before a process makes progress.
+     */
+    int wakeLatency = 0;
+
+    /**
+     * @brief Number of I/O devices serving the I/O phases of multi-phase processes.
+     */
+    int ioDevices = 1;
+
+    /**
+     * @brief Periodic tasks release no job at or after this time (0 picks a default from the workload).
+     */
+    int horizon = 0;
+
+    /**
+     * @brief Maximum number of processes waiting in the ready queue (0 for no limit).
+     */
+    int queueCapacity = 0;
+
+    /**
+     * @brief What happens to arrivals when the ready queue is full
+     *        ("reject", "drop-oldest", "drop-lowest-priority" or "token-bucket").
+     */
+    std::string admission = "reject";
+
+    /**
+     * @brief Tokens added to the admission token bucket per time unit ("token-bucket" only).
+     */
+    double tokenRate = 0.0;
+
+    /**
+     * @brief Capacity of the admission token bucket, i.e. the largest burst of arrivals admitted at once.
+     */
+    double tokenBurst = 10.0;
+
+    /**
+     * @brief Memory of the machine shared by the admitted processes (0 for no limit).
+     */
+    int memory = 0;
+
+    /**
+     * @brief Order in which processes blocked on memory are admitted ("fifo", "best-fit" or "drf").
+     */
+    std::string memoryPolicy = "fifo";
+
+    /**
+     * @brief File receiving the per-process results (empty for no export).
+     */
+    std::string exportFile;
+
+    /**
+     * @brief Format of the export file ("columnar" or "csv").
+     */
+    std::string exportFormat = "columnar";
+
+    /**
+     * @brief Policy ordering the processes within each group under "Group" ("FIFO", "SJF" or "Priority").
+     */
+    std::string groupPolicy = "FIFO";
+
+    /**
+     * @brief Comma-separated `path:weight` entries giving group weights under "Group" (default weight 1).
+     */
+    std::string groupWeights;
+
+    /**
+     * @brief Whether the wall time, event count, event rate and peak memory of the run are printed.
+     */
+    bool timing = false;
+
+    /**
+     * @brief Format of the data file: "workload" (arrival, burst, priority lines) or "trace"
+     *        (a `perf sched script` or ftrace text dump, converted to a workload file first).
+     */
+    std::string inputFormat = "workload";
+
+    /**
+     * @brief Length of one simulator time unit in microseconds when importing a trace.
+     */
+    int traceUnit = 1;
+
+    /**
+     * @brief Search strategy of the parameter tuner ("grid", "random" or "halving"; empty runs one simulation).
+     */
+    std::string tune;
+
+    /**
+     * @brief Parameters searched by the tuner, as comma-separated `name:low:high[:step]` entries
+     *        naming numeric options (e.g. "quantum:1:50,queue-capacity:10:100:10").
+     */
+    std::string tuneSpace;
+
+    /**
+     * @brief Metric the tuner optimizes ("avg-waiting", "avg-turnaround", "avg-response",
+     *        "p99-response", "p99-turnaround" or "throughput").
+     */
+    std::string tuneMetric = "avg-turnaround";
+
+    /**
+     * @brief Number of candidates drawn by the "random" and "halving" tuners.
+     */
+    int tuneSamples = 32;
+
+    /**
+     * @brief Number of worker threads evaluating tuner candidates (0 uses one per hardware thread).
+     */
+    int threads = 0;
+
+    /**
+     * @brief Event queue implementation: "multimap" (the reference) or "heap".
+     */
+    std::string engine = "multimap";
+
+    /**
+     * @brief Whether the events of a time step are handled together (batched ready-queue insertions
+     *        and deferred event pushes) rather than one at a time; both give identical results.
+     */
+    bool stepBatching = true;
+
+    /**
+     * @brief Number of random workloads on which the engines are compared after the data file
+     *        (0 runs the simulation normally).
+     */
+    int differential = 0;
+
+    /**
+     * @brief Maximum number of workloads kept in memory by the simulation server.
+     */
+    int cacheSize = 16;
+
+    /**
+     * @brief Whether the simulation resumes from and saves a checkpoint of the data file's prefix
+     *        (see `Checkpoint`).
+     */
+    bool checkpoint = false;
+
+    /**
+     * @brief Parses `--name=value` arguments into an `Options` object.
+     *
+     * @param argc The argument count passed to `main`.
+     * @param argv The argument vector passed to `main`.
+     * @param first The index of the first optional argument.
+     * @return The parsed options.
+     * @throws std::runtime_error if an argument is unknown or malformed.
+     */
+    static Options parse(int argc, char *argv[], int first);
+
+    /**
+     * @brief Sets an option from one `--name=value` argument.
+     *
+     * @param arg The argument.
+     * @throws std::runtime_error if the argument is malformed or the option is unknown.
+     */
+    void apply(const std::string &arg);
+
+    /**
+     * @brief Sets the option called `--name` from its command-line value.
+     *
+     * @param name The option name, without the leading dashes.
+     * @param value The option value.
+     * @throws std::runtime_error if the option is unknown or the value is malformed.
+     */
+    void set(const std::string &name, const std::string &value);
+};
+
+#endif // OPTIONS_H
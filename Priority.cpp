@@ -6,6 +6,11 @@ void Priority::addProcess(const Process &p)
     readyQueue.push(p); 
 }
 
+void Priority::addProcesses(const std::vector<Process> &processes)
+{
+    readyQueue.pushAll(processes);
+}
+
 Process Priority::getNextProcess()
 {
     if (readyQueue.empty())
@@ -21,4 +26,9 @@ Process Priority::getNextProcess()
 bool Priority::isEmpty() const
 {
     return readyQueue.empty();
-}
\ No newline at end of file
+}
+
+bool Priority::preempts(const Process &arriving, const Process &running) const
+{
+    return arriving.priority < running.priority;
+}
@@ -9,6 +9,7 @@
 #define PRIORITY_H
 
 #include "ReadyQueue.h"
+#include "ProcessHeap.h"
 #include <queue>
 #include <functional>
 
@@ -36,6 +37,13 @@ public:
      */
     void addProcess(const Process &p) override;
 
+    /**
+     * @brief Adds a batch of processes to the priority queue, rebuilding the heap once for large batches.
+     *
+     * @param processes The Process objects to be added to the queue.
+     */
+    void addProcesses(const std::vector<Process> &processes) override;
+
     /**
      * @brief Retrieves and removes the next process to execute from the priority queue.
      *
@@ -54,17 +62,26 @@ public:
      */
     bool isEmpty() const override;
 
+    /**
+     * @brief Checks if an arriving process has a strictly higher priority than the running one.
+     *
+     * @param arriving The process that became ready.
+     * @param running The process currently running on a CPU.
+     * @return True if `arriving` has a lower numerical priority value than `running`.
+     */
+    bool preempts(const Process &arriving, const Process &running) const override;
+
 private:
     /**
      * @brief The priority queue used to store and prioritize processes.
      *
      * Processes are stored in the priority queue with the following criteria:
      *  - Highest priority: Lowest numerical priority value.
-     *  - Tiebreaker: Earliest arrival time.
+     *  - Tiebreaker: Earliest arrival time, then lowest process ID.
      *
      * The custom comparator lambda function ensures this ordering.
      */
-    std::priority_queue<Process, std::vector<Process>, std::function<bool(const Process &, const Process &)>> readyQueue{
+    ProcessHeap<std::function<bool(const Process &, const Process &)>> readyQueue{
         /**
          * @brief Custom comparator for the priority queue.
          *
@@ -81,6 +98,10 @@ private:
         {
             if (p1.priority == p2.priority)
             {
+                if (p1.arrival_time == p2.arrival_time)
+                {
+                    return p1.process_id > p2.process_id; // Then the lower process ID, so that the order is total
+                }
                 return p1.arrival_time > p2.arrival_time; // Prioritize earlier arrival if priorities are equal
             }
             return p1.priority > p2.priority; // Prioritize lower priority value
@@ -8,6 +8,8 @@
 #ifndef PROCESS_H
 #define PROCESS_H
 
+#include <atomic>
+
 /**
  * @brief Represents a process in the CPU scheduling simulation.
  *
@@ -70,20 +72,117 @@ struct Process
 
     bool hasStarted = false;
 
+    /**
+     * @brief Timestamp when the process was last unloaded from a CPU.
+     *        Initialized to -1 to indicate the process has not run yet (its cache is cold).
+     */
+    int last_run_end = -1;
+
+    /**
+     * @brief Index of the CPU the process last ran on, or -1 if it has not run yet.
+     */
+    int last_cpu = -1;
+
+    /**
+     * @brief Timestamp when the process last became ready to run (arrived or left a CPU).
+     */
+    int ready_time = 0;
+
+    /**
+     * @brief Index of the process's first I/O phase in the workload's phase table.
+     *
+     * Phases after the first CPU burst are stored as (I/O length, CPU burst length) pairs in
+     * one table shared by every process, so multi-phase processes need no allocation of their own.
+     */
+    int phase_offset = 0;
+
+    /**
+     * @brief Number of entries the process owns in the phase table (twice the number of I/O phases).
+     */
+    int phase_count = 0;
+
+    /**
+     * @brief Index (relative to `phase_offset`) of the next I/O phase to run.
+     */
+    int next_phase = 0;
+
+    /**
+     * @brief Relative deadline of the process (0 means the process has no deadline).
+     */
+    int deadline = 0;
+
+    /**
+     * @brief Release period of a periodic task (0 means the process is released once).
+     */
+    int period = 0;
+
+    /**
+     * @brief Timestamp by which the process must complete, or -1 if it has no deadline.
+     */
+    int absolute_deadline = -1;
+
+    /**
+     * @brief Number of tickets held by the process under proportional-share algorithms.
+     */
+    int tickets = 1;
+
+    /**
+     * @brief Index of the group (tenant or container) the process belongs to.
+     */
+    int group = 0;
+
+    /**
+     * @brief Number of threads of the job, which run at the same time on as many CPUs under gang scheduling.
+     */
+    int threads = 1;
+
+    /**
+     * @brief Memory the process holds from its admission until it completes.
+     */
+    int memory = 0;
+
+    /**
+     * @brief Time the process spent blocked on memory before its admission.
+     */
+    int memory_wait = 0;
+
+    /**
+     * @brief Pass value of the process under stride scheduling.
+     */
+    long long pass = 0;
+
+    /**
+     * @brief Total time the process has spent on a CPU, including context-switch overhead.
+     */
+    int cpu_time = 0;
+
+    /**
+     * @brief Virtual time at which the process last became runnable (used to measure share tracking).
+     */
+    double share_start = 0.0;
+
+    /**
+     * @brief CPU time the process would have received so far under ideal proportional sharing.
+     */
+    double share_ideal = 0.0;
+
     /**
      * @brief Next available process ID.
      *
      * This static member variable holds the next available unique identifier
-     * to be assigned to a new Process object. It is automatically incremented
-     * each time a Process is created.
+     * to be assigned to a new Process object. It is incremented each time a
+     * Process is created with the (arrival, burst, priority) constructor, i.e.
+     * for every process parsed from a data file. It is atomic because workloads
+     * may be loaded while simulations run on other threads.
      */
-    inline static int nextProcessId = 1;
+    inline static std::atomic<int> nextProcessId{1};
 
     /**
      * @brief Default constructor for the Process structure.
-     * Initializes all members to default values and assigns a unique process ID.
+     * Initializes all members to default values. No process ID is assigned (the ID is 0),
+     * so placeholder and scratch processes do not touch the shared `nextProcessId`.
      */
-    Process() : process_id(nextProcessId++), arrival_time(0), burst_time(0), priority(0){}
+    Process() : process_id(0), arrival_time(0), burst_time(0), priority(0){}
 
     /**
      * @brief Parameterized constructor for creating a new Process object.
@@ -95,7 +194,18 @@ struct Process
      * @param priority The priority of the process (optional, defaults to 0).
      */
     Process(const int &arrivalTime, const int &burstTime, const int &priority) : process_id(nextProcessId++), arrival_time(arrivalTime), burst_time(burstTime),
-                                                                                 priority(priority) {}
+                                                                                 priority(priority), ready_time(arrivalTime) {}
+
+    /**
+     * @brief Creates a process with a given ID, leaving `nextProcessId` untouched.
+     *
+     * @param processId The ID of the process.
+     * @param arrivalTime The timestamp when the process arrives in the system.
+     * @param burstTime The total time the process needs to run on the CPU.
+     * @param priority The priority of the process.
+     */
+    Process(int processId, int arrivalTime, int burstTime, int priority) : process_id(processId), arrival_time(arrivalTime), burst_time(burstTime),
+                                                                           priority(priority), ready_time(arrivalTime) {}
 
     /**
      * @brief Copy constructor for creating a new Process object as a copy of an existing one.
@@ -114,6 +224,24 @@ struct Process
         turnaround_time = other.turnaround_time;
         response_time = other.response_time;
         hasStarted = other.hasStarted;
+        last_run_end = other.last_run_end;
+        last_cpu = other.last_cpu;
+        ready_time = other.ready_time;
+        phase_offset = other.phase_offset;
+        phase_count = other.phase_count;
+        next_phase = other.next_phase;
+        deadline = other.deadline;
+        period = other.period;
+        absolute_deadline = other.absolute_deadline;
+        tickets = other.tickets;
+        group = other.group;
+        threads = other.threads;
+        memory = other.memory;
+        memory_wait = other.memory_wait;
+        pass = other.pass;
+        cpu_time = other.cpu_time;
+        share_start = other.share_start;
+        share_ideal = other.share_ideal;
     }
 };
 
@@ -0,0 +1,129 @@
+#include "ProcessColumns.h"
+#include <charconv>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+
+namespace
+{
+    /**
+     * @brief Size of the blocks in which the exporters write to disk.
+     */
+    constexpr size_t WRITE_BLOCK_SIZE = 1 << 20;
+
+    template <typename T>
+    void writeValue(std::ofstream &out, T value)
+    {
+        out.write(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+}
+
+ProcessColumns ProcessColumns::fromProcesses(const std::vector<Process> &processes)
+{
+    ProcessColumns columns;
+    size_t rows = processes.size();
+    for (std::vector<int> *column : {&columns.processId, &columns.arrival, &columns.start, &columns.completion,
+                                     &columns.wait, &columns.turnaround, &columns.response})
+    {
+        column->resize(rows);
+    }
+
+    for (size_t i = 0; i < rows; i++)
+    {
+        const Process &p = processes[i];
+        columns.processId[i] = p.process_id;
+        columns.arrival[i] = p.arrival_time;
+        columns.start[i] = p.arrival_time + p.response_time;
+        columns.completion[i] = p.completion_time;
+        columns.wait[i] = p.wait_time;
+        columns.turnaround[i] = p.completion_time - p.arrival_time;
+        columns.response[i] = p.response_time;
+    }
+    return columns;
+}
+
+size_t ProcessColumns::size() const
+{
+    return processId.size();
+}
+
+void ProcessColumns::writeColumnar(const std::string &fileName) const
+{
+    const std::vector<std::pair<std::string, const std::vector<int> *>> columns = {
+        {"process_id", &processId}, {"arrival", &arrival}, {"start", &start}, {"completion", &completion},
+        {"wait", &wait}, {"turnaround", &turnaround}, {"response", &response}};
+
+    std::ofstream out(fileName, std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+    {
+        throw std::runtime_error("Error opening export file: " + fileName);
+    }
+
+    out.write("CPUSCOL1", 8);
+    writeValue<uint32_t>(out, static_cast<uint32_t>(columns.size()));
+    writeValue<uint64_t>(out, static_cast<uint64_t>(size()));
+    for (const auto &column : columns)
+    {
+        writeValue<uint32_t>(out, static_cast<uint32_t>(column.first.size()));
+        out.write(column.first.data(), column.first.size());
+    }
+    for (const auto &column : columns)
+    {
+        out.write(reinterpret_cast<const char *>(column.second->data()),
+                  static_cast<std::streamsize>(column.second->size() * sizeof(int)));
+    }
+
+    if (!out)
+    {
+        throw std::runtime_error("Error writing export file: " + fileName);
+    }
+}
+
+void ProcessColumns::writeCSV(const std::string &fileName) const
+{
+    std::ofstream out(fileName, std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+    {
+        throw std::runtime_error("Error opening export file: " + fileName);
+    }
+
+    const std::vector<int> *columns[] = {&processId, &arrival, &start, &completion, &wait, &turnaround, &response};
+    std::string buffer = "process_id,arrival,start,completion,wait,turnaround,response\n";
+    buffer.reserve(WRITE_BLOCK_SIZE + 128);
+
+    char field[16];
+    for (size_t row = 0; row < size(); row++)
+    {
+        for (size_t c = 0; c < 7; c++)
+        {
+            char *end = std::to_chars(field, field + sizeof(field), (*columns[c])[row]).ptr;
+            buffer.append(field, end);
+            buffer.push_back(c + 1 < 7 ? ',' : '\n');
+        }
+        if (buffer.size() >= WRITE_BLOCK_SIZE)
+        {
+            out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    }
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+    if (!out)
+    {
+        throw std::runtime_error("Error writing export file: " + fileName);
+    }
+}
+
+long long columnSum(const std::vector<int> &column)
+{
+    const int *values = column.data();
+    size_t count = column.size();
+    long long total = 0;
+
+#pragma omp simd reduction(+ : total)
+    for (size_t i = 0; i < count; i++)
+    {
+        total += values[i];
+    }
+    return total;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file ProcessColumns.h
+ * @brief Defines the columnar per-process results table and its exporters.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef PROCESSCOLUMNS_H
+#define PROCESSCOLUMNS_H
+
+#include "Process.h"
+#include <string>
+#include <vector>
+
+/**
+ * @brief Per-process results of a simulation, stored column by column.
+ *
+ * Every column is a contiguous array of 32-bit integers, so aggregates are computed with
+ * tight loops over one column at a time (see `columnSum`) and whole columns are written
+ * to disk with a single call each.
+ *
+ * Columnar file layout (native byte order, little-endian on every supported platform):
+ *   - the 8-byte magic "CPUSCOL1";
+ *   - the number of columns (uint32) and of rows (uint64);
+ *   - for every column, its name length (uint32) followed by the name;
+ *   - for every column in the same order, one int32 value per row.
+ */
+struct ProcessColumns
+{
+    std::vector<int> processId;  /**< @brief Process ID. */
+    std::vector<int> arrival;    /**< @brief Arrival time. */
+    std::vector<int> start;      /**< @brief Time at which the process first made progress on a CPU. */
+    std::vector<int> completion; /**< @brief Completion time. */
+    std::vector<int> wait;       /**< @brief Total time spent waiting in the ready queue. */
+    std::vector<int> turnaround; /**< @brief Completion time minus arrival time. */
+    std::vector<int> response;   /**< @brief Start time minus arrival time. */
+
+    /**
+     * @brief Builds the columns from completed processes.
+     *
+     * @param processes The completed processes.
+     * @return The per-process columns, one row per process in the same order.
+     */
+    static ProcessColumns fromProcesses(const std::vector<Process> &processes);
+
+    /**
+     * @brief Gets the number of rows.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Writes the columns in the columnar binary format described above.
+     *
+     * @param fileName The file to write.
+     * @throws std::runtime_error if the file cannot be written.
+     */
+    void writeColumnar(const std::string &fileName) const;
+
+    /**
+     * @brief Writes the columns as CSV with a header line.
+     *
+     * Rows are formatted into a large buffer that is flushed in blocks.
+     *
+     * @param fileName The file to write.
+     * @throws std::runtime_error if the file cannot be written.
+     */
+    void writeCSV(const std::string &fileName) const;
+};
+
+/**
+ * @brief Returns the sum of a column.
+ *
+ * The loop is written for the compiler to vectorize (OpenMP SIMD reduction).
+ *
+ * @param column The values to add up.
+ * @return The sum, accumulated in 64 bits.
+ */
+long long columnSum(const std::vector<int> &column);
+
+#endif // PROCESSCOLUMNS_H
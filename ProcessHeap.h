@@ -0,0 +1,51 @@
+/**
+ * @file ProcessHeap.h
+ * @brief Defines the `ProcessHeap` priority queue of processes that accepts batches of insertions.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef PROCESSHEAP_H
+#define PROCESSHEAP_H
+
+#include "Process.h"
+#include <algorithm>
+#include <queue>
+#include <vector>
+
+/**
+ * @brief A `std::priority_queue` of processes that can insert a batch with a single heapify.
+ *
+ * Pushing k processes onto a heap of n costs O(k log(n + k)); rebuilding the heap costs
+ * O(n + k), which is cheaper once the batch is about as large as the heap. The order in
+ * which processes leave the heap is the same either way as long as `Compare` is a total order.
+ *
+ * @tparam Compare The heap's comparator, as for `std::priority_queue`.
+ */
+template <typename Compare>
+class ProcessHeap : public std::priority_queue<Process, std::vector<Process>, Compare>
+{
+public:
+    using std::priority_queue<Process, std::vector<Process>, Compare>::priority_queue;
+
+    /**
+     * @brief Inserts every process of a batch.
+     *
+     * @param processes The processes to insert.
+     */
+    void pushAll(const std::vector<Process> &processes)
+    {
+        if (processes.size() < this->c.size())
+        {
+            for (const Process &p : processes)
+            {
+                this->push(p);
+            }
+            return;
+        }
+        this->c.insert(this->c.end(), processes.begin(), processes.end());
+        std::make_heap(this->c.begin(), this->c.end(), this->comp);
+    }
+};
+
+#endif // PROCESSHEAP_H
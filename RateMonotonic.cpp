@@ -0,0 +1,44 @@
+#include "RateMonotonic.h"
+#include <stdexcept>
+#include <limits>
+
+void RateMonotonic::addProcess(const Process &p)
+{
+    readyQueue.push(p);
+}
+
+void RateMonotonic::addProcesses(const std::vector<Process> &processes)
+{
+    readyQueue.pushAll(processes);
+}
+
+Process RateMonotonic::getNextProcess()
+{
+    if (readyQueue.empty())
+    {
+        throw std::runtime_error("Error: Attempting to get a process from an empty RM queue");
+    }
+
+    Process nextProcess = readyQueue.top();
+    readyQueue.pop();
+    return nextProcess;
+}
+
+bool RateMonotonic::isEmpty() const
+{
+    return readyQueue.empty();
+}
+
+bool RateMonotonic::preempts(const Process &arriving, const Process &running) const
+{
+    return rankOf(arriving) < rankOf(running);
+}
+
+int RateMonotonic::rankOf(const Process &p)
+{
+    if (p.period > 0)
+    {
+        return p.period;
+    }
+    return p.deadline > 0 ? p.deadline : std::numeric_limits<int>::max();
+}
@@ -0,0 +1,99 @@
+/**
+ * @file RateMonotonic.h
+ * @brief Defines the rate-monotonic ready queue class for a CPU scheduling simulation.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef RATEMONOTONIC_H
+#define RATEMONOTONIC_H
+
+#include "ReadyQueue.h"
+#include "ProcessHeap.h"
+#include <queue>
+#include <functional>
+
+/**
+ * @brief Ready queue implementation for the rate-monotonic (RM) real-time scheduling algorithm.
+ *
+ * Each process has a fixed priority derived from its period: the shorter the period, the
+ * higher the priority. Aperiodic processes with a deadline are ranked by their relative
+ * deadline (deadline-monotonic), and processes with neither run last. In case of a tie, the
+ * process with the earlier arrival time is prioritized.
+ *
+ * The algorithm is preemptive: a process that becomes ready with a shorter period than a
+ * running process takes its CPU.
+ */
+class RateMonotonic : public ReadyQueue
+{
+public:
+    /**
+     * @brief Adds a process to the rate-monotonic ready queue.
+     *
+     * @param p The Process object to be added to the queue.
+     */
+    void addProcess(const Process &p) override;
+
+    /**
+     * @brief Adds a batch of processes to the rate-monotonic ready queue, rebuilding the heap once for large batches.
+     *
+     * @param processes The Process objects to be added to the queue.
+     */
+    void addProcesses(const std::vector<Process> &processes) override;
+
+    /**
+     * @brief Retrieves and removes the process with the shortest period.
+     *
+     * @return The Process object with the highest rate-monotonic priority.
+     * @throws std::runtime_error if the queue is empty.
+     */
+    Process getNextProcess() override;
+
+    /**
+     * @brief Checks if the rate-monotonic ready queue is empty.
+     *
+     * @return True if the queue is empty, false otherwise.
+     */
+    bool isEmpty() const override;
+
+    /**
+     * @brief Checks if an arriving process has a strictly shorter period than the running one.
+     *
+     * @param arriving The process that became ready.
+     * @param running The process currently running on a CPU.
+     * @return True if `arriving` has a higher rate-monotonic priority than `running`.
+     */
+    bool preempts(const Process &arriving, const Process &running) const override;
+
+    /**
+     * @brief Returns the static rate-monotonic rank of a process (lower runs first).
+     *
+     * @param p The process.
+     * @return The period, else the relative deadline, else the largest `int`.
+     */
+    static int rankOf(const Process &p);
+
+private:
+    /**
+     * @brief The priority queue used to store and prioritize processes.
+     *
+     * Processes are stored in the priority queue with the following criteria:
+     *  - Highest priority: Shortest period (or relative deadline for aperiodic processes).
+     *  - Tiebreaker: Earliest arrival time, then lowest process ID.
+     */
+    ProcessHeap<std::function<bool(const Process &, const Process &)>> readyQueue{
+        [](const Process &p1, const Process &p2)
+        {
+            if (rankOf(p1) == rankOf(p2))
+            {
+                if (p1.arrival_time == p2.arrival_time)
+                {
+                    return p1.process_id > p2.process_id; // Then the lower process ID, so that the order is total
+                }
+                return p1.arrival_time > p2.arrival_time; // Prioritize earlier arrival if ranks are equal
+            }
+            return rankOf(p1) > rankOf(p2); // Prioritize shorter period
+        }};
+};
+
+#endif // RATEMONOTONIC_H
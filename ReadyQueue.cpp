@@ -0,0 +1,42 @@
+#include "ReadyQueue.h"
+#include "FIFO.h"
+#include "SJF.h"
+#include "Priority.h"
+#include "EDF.h"
+#include "RateMonotonic.h"
+#include "Stride.h"
+#include "Lottery.h"
+#include <stdexcept>
+
+ReadyQueue *ReadyQueue::create(const std::string &algorithmType, const Options &options)
+{
+    if (algorithmType == "FIFO")
+    {
+        return new FIFO();
+    }
+    else if (algorithmType == "SJF")
+    {
+        return new SJF();
+    }
+    else if (algorithmType == "Priority")
+    {
+        return new Priority();
+    }
+    else if (algorithmType == "EDF")
+    {
+        return new EDF();
+    }
+    else if (algorithmType == "RM")
+    {
+        return new RateMonotonic();
+    }
+    else if (algorithmType == "Stride")
+    {
+        return new Stride();
+    }
+    else if (algorithmType == "Lottery")
+    {
+        return new Lottery(options.seed);
+    }
+    throw std::runtime_error("Invalid algorithm type");
+}
@@ -10,6 +10,9 @@
 
 #include "Process.h"
 #include "Event.h"
+#include "Options.h"
+#include <string>
+#include <vector>
 
 /**
  * @class ReadyQueue
@@ -20,6 +23,22 @@
  */
 class ReadyQueue {
 public:
+    /**
+     * @brief Virtual destructor so that derived queues can be deleted through a `ReadyQueue` pointer.
+     */
+    virtual ~ReadyQueue() = default;
+
+    /**
+     * @brief Creates the ready queue that implements the named scheduling algorithm.
+     *
+     * @param algorithmType The type of scheduling algorithm ("FIFO", "SJF", "Priority", "EDF", "RM",
+     *                      "Stride", or "Lottery").
+     * @param options The simulation options (the seed is used by randomized algorithms).
+     * @return A newly allocated ready queue owned by the caller.
+     * @throws std::runtime_error if the algorithm type is unknown.
+     */
+    static ReadyQueue* create(const std::string& algorithmType, const Options& options = Options());
+
     /**
      * @brief  Adds a process to the ready queue.
      *
@@ -29,6 +48,22 @@ public:
      */
     virtual void addProcess(const Process& p) = 0; 
 
+    /**
+     * @brief Adds several processes to the ready queue, as if by `addProcess` in order.
+     *
+     * Queues that can insert a batch faster than one process at a time override this;
+     * the default adds the processes one by one.
+     *
+     * @param processes The processes to be added to the queue.
+     */
+    virtual void addProcesses(const std::vector<Process>& processes)
+    {
+        for (const Process& p : processes)
+        {
+            addProcess(p);
+        }
+    }
+
     /**
      * @brief Gets the next process to be scheduled from the ready queue.
      *
@@ -44,6 +79,29 @@ public:
      * @return `true` if the queue is empty, `false` otherwise.
      */
     virtual bool isEmpty() const = 0;  
+
+    /**
+     * @brief Checks if a process that becomes ready should preempt a running process.
+     *
+     * Non-preemptive algorithms keep the default, which never preempts.
+     *
+     * @param arriving The process that became ready.
+     * @param running The process currently running on a CPU.
+     * @return `true` if `arriving` should take the CPU from `running`, `false` otherwise.
+     */
+    virtual bool preempts(const Process& arriving, const Process& running) const { return false; }
+
+    /**
+     * @brief Informs the queue that a process left a CPU after using it for some time.
+     *
+     * Called for every process unloaded from a CPU, before it is added back to the queue
+     * (if it is). Algorithms that account for CPU usage update the process here; the
+     * default does nothing.
+     *
+     * @param p The process that left the CPU.
+     * @param usedTime The time the process spent on the CPU.
+     */
+    virtual void chargeUsage(Process& p, int usedTime) {}
 };
 
 #endif // READYQUEUE_H
@@ -6,6 +6,11 @@ void SJF::addProcess(const Process &p)
     readyQueue.push(p); 
 }
 
+void SJF::addProcesses(const std::vector<Process> &processes)
+{
+    readyQueue.pushAll(processes);
+}
+
 Process SJF::getNextProcess()
 {
     if (readyQueue.empty())
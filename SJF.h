@@ -9,6 +9,7 @@
 #define SJF_H
 
 #include "ReadyQueue.h"
+#include "ProcessHeap.h"
 #include <queue>
 #include <functional>
 
@@ -33,6 +34,13 @@ public:
      */
     void addProcess(const Process &p) override;
 
+    /**
+     * @brief Adds a batch of processes to the SJF ready queue, rebuilding the heap once for large batches.
+     *
+     * @param processes The Process objects to be added to the queue.
+     */
+    void addProcesses(const std::vector<Process> &processes) override;
+
     /**
      * @brief Retrieves and removes the next process to execute from the SJF ready queue.
      *
@@ -57,11 +65,11 @@ private:
      *
      * Processes are stored in the priority queue with the following criteria:
      *  - Highest priority: Shortest burst time.
-     *  - Tiebreaker: Earliest arrival time.
+     *  - Tiebreaker: Earliest arrival time, then lowest process ID.
      *
      * The custom comparator lambda function ensures this ordering.
      */
-    std::priority_queue<Process, std::vector<Process>, std::function<bool(const Process &, const Process &)>> readyQueue{
+    ProcessHeap<std::function<bool(const Process &, const Process &)>> readyQueue{
         /**
          * @brief Custom comparator for the priority queue.
          *
@@ -78,6 +86,10 @@ private:
         {
             if (p1.burst_time == p2.burst_time)
             {
+                if (p1.arrival_time == p2.arrival_time)
+                {
+                    return p1.process_id > p2.process_id; // Then the lower process ID, so that the order is total
+                }
                 return p1.arrival_time > p2.arrival_time; // Prioritize earlier arrival if burst times are equal
             }
             return p1.burst_time > p2.burst_time; // Prioritize shorter burst time
@@ -1,136 +1,503 @@
 #include "Scheduler.h"
+#include "Cluster.h"
+#include "GangScheduler.h"
+#include "Tuner.h"
+#include "TraceImporter.h"
+#include "DifferentialTester.h"
+#include "Server.h"
+#include "Metrics.h"
+#include "ProcessColumns.h"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
-#include <sstream>
 #include <fstream>
 #include <filesystem>
+#include <chrono>
+#include <sys/resource.h>
 
 int main(int argc, char *argv[])
 {
-    if (argc != 3)
+    if (argc < 3)
     {
-        std::cerr << "Usage: " << argv[0] << " <filename> <algorithm_type>" << std::endl;
+        std::cerr << "Usage: " << argv[0] << " <filename> <algorithm_type> [--option=value ...]" << std::endl;
+        std::cerr << "       " << argv[0] << " --serve <socket_path> [--option=value ...]" << std::endl;
         return 1;
     }
 
+    if (std::string(argv[1]) == "--serve")
+    {
+        Server server(argv[2], Options::parse(argc, argv, 3));
+        server.run();
+        return 0;
+    }
+
     std::string fileName = argv[1];
     std::string algorithmType = argv[2];
+    Options options = Options::parse(argc, argv, 3);
+
+    if (options.inputFormat == "trace")
+    {
+        // Simulate the workload reconstructed from the trace.
+        TraceImporter importer(options.traceUnit);
+        std::string workloadFile = std::filesystem::path(fileName).stem().string() + "-workload.txt";
+        importer.convert(fileName, workloadFile);
+        std::cout << "Imported " << importer.getJobCount() << " jobs from " << importer.getEventCount()
+                  << " scheduler events into " << workloadFile << std::endl;
+        if (options.maxProcesses > 0 && importer.getJobCount() > options.maxProcesses)
+        {
+            std::cerr << "Warning: only the first " << options.maxProcesses << " of " << importer.getJobCount()
+                      << " imported jobs are simulated; use --max-processes=0 to simulate all of them" << std::endl;
+        }
+        fileName = workloadFile;
+    }
+    else if (options.inputFormat != "workload")
+    {
+        throw std::runtime_error("Invalid input format: " + options.inputFormat);
+    }
+
+    if (!options.tune.empty())
+    {
+        Tuner tuner(Workload::load(fileName, options.maxProcesses), algorithmType, options);
+        tuner.run();
+        tuner.printResults(fileName);
+        return 0;
+    }
+
+    if (options.differential > 0)
+    {
+        DifferentialTester tester(algorithmType, options);
+        return tester.run(fileName) ? 0 : 1;
+    }
+
+    if (algorithmType == "Gang" || algorithmType == "Backfill")
+    {
+        GangScheduler gang(Workload::load(fileName, options.maxProcesses), algorithmType, options);
+        gang.runSimulation();
+        gang.printStatistics(fileName);
+        return 0;
+    }
+
+    if (options.nodes > 0)
+    {
+        Cluster cluster(Workload::load(fileName, options.maxProcesses), algorithmType, options);
+        cluster.runSimulation();
+        cluster.printStatistics(fileName);
+        return 0;
+    }
 
-    Scheduler scheduler(fileName, algorithmType);
-    scheduler.runSimulation();
-    scheduler.printStatistics(fileName);
+    auto started = std::chrono::steady_clock::now();
+    std::unique_ptr<Checkpoint> checkpoint;
+    std::unique_ptr<Scheduler> scheduler;
+    if (options.checkpoint)
+    {
+        checkpoint = std::make_unique<Checkpoint>(fileName, algorithmType, options);
+        scheduler = checkpoint->createScheduler();
+        std::cout << checkpoint->getStatus() << std::endl;
+    }
+    else
+    {
+        scheduler = std::make_unique<Scheduler>(fileName, algorithmType, options);
+    }
+    auto loaded = std::chrono::steady_clock::now();
+    scheduler->runSimulation();
+    auto simulated = std::chrono::steady_clock::now();
+    scheduler->printStatistics(fileName);
+
+    if (options.timing)
+    {
+        double simulationTime = std::chrono::duration<double>(simulated - loaded).count();
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+
+        std::cout << "Wall time (s): " << std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count() << std::endl;
+        std::cout << "Events: " << scheduler->getEventCount() << std::endl;
+        std::cout << "Events per second: " << static_cast<long long>(scheduler->getEventCount() / std::max(simulationTime, 1e-9)) << std::endl;
+        std::cout << "Peak RSS (KiB): " << usage.ru_maxrss << std::endl;
+    }
 
     return 0;
 }
 
-Scheduler::Scheduler(const std::string &fileName, const std::string &algorithmType)
+Scheduler::Scheduler(const std::string &fileName, const std::string &algorithmType, const Options &options)
+    : Scheduler(Workload::load(fileName, options.maxProcesses), algorithmType, options)
+{
+}
+
+Scheduler::Scheduler(const Workload &workload, const std::string &algorithmType, const Options &options)
 {
     this->algorithmType = algorithmType;
-    loadProcessesFromFile(fileName);
+    quantum = options.quantum;
+    preemptive = options.preemption;
+    stepBatching = options.stepBatching;
+    releaseHorizon = options.horizon;
+    reportSwitching = quantum > 0 || options.contextSwitchCost > 0 || options.cacheMissPenalty > 0;
+    reportEnergy = !options.cores.empty();
+    placement = options.placement;
+    exportFile = options.exportFile;
+    exportFormat = options.exportFormat;
+    bigBurstThreshold = options.bigBurstThreshold;
 
-    if (algorithmType == "FIFO")
+    if (placement != "first" && placement != "fastest" && placement != "size")
     {
-        readyQueue = new FIFO();
+        throw std::runtime_error("Invalid placement policy: " + placement);
     }
-    else if (algorithmType == "SJF")
+    if (exportFormat != "columnar" && exportFormat != "csv")
+    {
+        throw std::runtime_error("Invalid export format: " + exportFormat);
+    }
+    eventQueue.reset(EventQueue::create(options.engine));
+
+    std::vector<CoreType> cores = reportEnergy ? CoreType::parseList(options.cores) : std::vector<CoreType>(1);
+    cpus.reserve(cores.size());
+    for (size_t i = 0; i < cores.size(); i++)
     {
-        readyQueue = new SJF();
+        cpus.emplace_back(options.contextSwitchCost, options.cacheMissPenalty, options.cacheWarmWindow,
+                          static_cast<int>(i), cores[i], options.wakeLatency);
     }
-    else if (algorithmType == "Priority")
+    pendingEvents.resize(cpus.size());
+    deferredEvents.resize(cpus.size());
+    hasDeferredEvent.resize(cpus.size());
+
+    if (algorithmType == "Group")
     {
-        readyQueue = new Priority();
+        readyQueue = new HierarchicalQueue(workload.groups, options);
     }
     else
     {
-        throw std::runtime_error("Invalid algorithm type");
+        // Round Robin is a FIFO ready queue with time slicing.
+        bool roundRobin = algorithmType == "RR" || algorithmType == "AdaptiveRR";
+        readyQueue = ReadyQueue::create(roundRobin ? "FIFO" : algorithmType, options);
+    }
+    if (options.queueCapacity > 0 || options.admission != "reject")
+    {
+        boundedQueue = new BoundedReadyQueue(readyQueue, options);
+        readyQueue = boundedQueue;
+    }
+    trackShares = algorithmType == "Stride" || algorithmType == "Lottery";
+    if ((algorithmType == "RR" || algorithmType == "AdaptiveRR" || algorithmType == "Group" || trackShares) && quantum == 0)
+    {
+        // Time-sliced algorithms need a quantum to share the CPU at all.
+        quantum = DEFAULT_RR_QUANTUM;
+        reportSwitching = true;
     }
+    if (algorithmType == "AdaptiveRR")
+    {
+        adaptiveQuantum = std::make_unique<AdaptiveQuantum>(options, quantum);
+    }
+    if (options.memory != 0)
+    {
+        if (boundedQueue != nullptr)
+        {
+            throw std::runtime_error("Memory limits do not support admission control");
+        }
+        memory = std::make_unique<MemoryManager>(options, static_cast<int>(cpus.size()));
+    }
+    if (options.ioDevices < 1)
+    {
+        throw std::runtime_error("At least one I/O device is required");
+    }
+    devices.resize(options.ioDevices);
+
+    loadProcesses(workload, options.maxProcesses);
 }
 
-void Scheduler::loadProcessesFromFile(const std::string &fileName)
+Scheduler::~Scheduler()
 {
-    std::ifstream inputFile(fileName);
+    delete readyQueue;
+}
 
-    if (!inputFile.is_open())
+void Scheduler::loadProcesses(const Workload &workload, int maxProcesses)
+{
+    size_t count = workload.processes.size();
+    if (maxProcesses > 0)
     {
-        throw std::runtime_error("Error opening file: " + fileName);
+        count = std::min(count, static_cast<size_t>(maxProcesses));
     }
 
-    std::string headerLine;
-    std::getline(inputFile, headerLine);
-
-    int arrivalTime, burstTime, priority;
+    int lastArrival = 0;
+    int longestPeriod = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const Process &p = workload.processes[i];
+        if (p.threads > 1)
+        {
+            throw std::runtime_error("Multi-threaded processes need the Gang or Backfill algorithm");
+        }
+        eventQueue->push(Event(Event::ARRIVAL, p.arrival_time, p));
+        lastArrival = std::max(lastArrival, p.arrival_time);
+        longestPeriod = std::max(longestPeriod, p.period);
+        nextJobId = std::max(nextJobId, p.process_id + 1);
+    }
+    phaseTable = workload.phases;
+    groupNames = workload.groups;
 
-    std::string line;
-    int processCount = 0;
+    if (releaseHorizon == 0)
+    {
+        releaseHorizon = lastArrival + DEFAULT_HORIZON_PERIODS * longestPeriod;
+    }
+}
 
-    while (std::getline(inputFile, line) && processCount < 500)
+void Scheduler::runSimulation()
+{
+    while (!eventQueue->empty())
     {
-        std::istringstream iss(line);
+        if (checkpoint != nullptr && eventQueue->top().timestamp >= checkpointTime)
+        {
+            checkpoint->save(*this);
+            checkpoint = nullptr;
+        }
 
-        if (!(iss >> arrivalTime >> burstTime >> priority))
+        // Update the current time
+        currentTime = eventQueue->top().timestamp;
+        if (trackShares)
         {
-            throw std::runtime_error("Invalid line format in file: " + line);
+            advanceVirtualTime(currentTime);
         }
-        Process p{arrivalTime, burstTime, priority};
 
-        eventQueue.push(Event(Event::ARRIVAL, arrivalTime, p));
+        // Handle every event of this time step before the next step's events are looked at
+        // (without step batching, the loop handles one event per iteration, the reference behavior)
+        do
+        {
+            Event currentEvent = eventQueue->top();
+            eventQueue->pop();
+            eventCount++;
+
+            if (currentEvent.type != Event::ARRIVAL)
+            {
+                flushReadyBatch();
+            }
 
-        processCount++;
+            // Handle the event based on its type
+            switch (currentEvent.type)
+            {
+            case Event::ARRIVAL:
+                handleArrivalEvent(currentEvent, currentTime);
+                break;
+            case Event::COMPLETION:
+                handleCompletionEvent(currentEvent, currentTime);
+                break;
+            case Event::QUANTUM_EXPIRED:
+                handleQuantumExpiredEvent(currentEvent, currentTime);
+                break;
+            case Event::IO_START:
+                handleIOStartEvent(currentEvent, currentTime);
+                break;
+            case Event::IO_COMPLETION:
+                handleIOCompletionEvent(currentEvent, currentTime);
+                break;
+            }
+        } while (stepBatching && !eventQueue->empty() && eventQueue->top().timestamp == currentTime);
 
+        flushReadyBatch();
+        flushDeferredEvents();
     }
+}
 
-    inputFile.close();
+void Scheduler::flushReadyBatch()
+{
+    if (!readyBatch.empty())
+    {
+        readyQueue->addProcesses(readyBatch);
+        readyBatch.clear();
+    }
 }
 
-void Scheduler::runSimulation()
+void Scheduler::flushDeferredEvents()
 {
-    while (!eventQueue.empty())
+    for (size_t i = 0; i < cpus.size(); i++)
     {
-        // Get the next event from the queue
-        Event currentEvent = eventQueue.top();
-        eventQueue.pop();
+        if (hasDeferredEvent[i])
+        {
+            eventQueue->push(deferredEvents[i]);
+            hasDeferredEvent[i] = false;
+        }
+    }
+}
 
-        // Update the current time
-        currentTime = currentEvent.timestamp;
+int Scheduler::selectIdleCPU(const Process &p) const
+{
+    int selected = -1;
 
-        // Handle the event based on its type
-        switch (currentEvent.type)
+    for (const CPU &candidate : cpus)
+    {
+        if (!candidate.isIdle())
+        {
+            continue;
+        }
+        if (selected < 0)
         {
-        case Event::ARRIVAL:
-            handleArrivalEvent(currentEvent, currentTime);
-            break;
-        case Event::COMPLETION:
-            handleCompletionEvent(currentEvent, currentTime);
-            break;
+            selected = candidate.getId();
+            if (placement == "first")
+            {
+                break;
+            }
+            continue;
+        }
+
+        const CoreType &best = cpus[selected].getType();
+        const CoreType &type = candidate.getType();
+        bool preferFast = placement == "fastest" || p.burst_time - p.completed_burst_time >= bigBurstThreshold;
+
+        if (preferFast ? type.speed > best.speed
+                       : type.activePower / type.speed < best.activePower / best.speed)
+        {
+            selected = candidate.getId();
         }
     }
-    
+
+    return selected;
 }
 
-void Scheduler::handleArrivalEvent(const Event &arrivalEvent, const int &currentTime)
+void Scheduler::dispatchProcess(const Process &p, int cpuIndex, const int &currentTime)
 {
-    if (cpu.isIdle())
+    if (logDispatches)
     {
-        int completionTime = cpu.loadProcess(arrivalEvent.process, currentTime);
-        eventQueue.push(Event(Event::COMPLETION, completionTime, arrivalEvent.process));
+        dispatches.push_back(Dispatch{currentTime, cpuIndex, p.process_id});
+    }
+    int completionTime = cpus[cpuIndex].loadProcess(p, currentTime);
+    const Process &running = *cpus[cpuIndex].getRunningProcess();
+    int remainingTime = cpus[cpuIndex].timeForWork(p.burst_time - p.completed_burst_time);
+    scheduleNextEvent(running, cpuIndex, completionTime - remainingTime, completionTime);
+}
+
+void Scheduler::scheduleNextEvent(const Process &running, int cpuIndex, const int &sliceStart, const int &completionTime)
+{
+    Event event(Event::COMPLETION, completionTime, running);
+    if (quantum > 0 && completionTime - sliceStart > quantum)
+    {
+        event.type = Event::QUANTUM_EXPIRED;
+        event.timestamp = sliceStart + quantum;
+    }
+    event.cpu = cpuIndex;
+    pendingEvents[cpuIndex] = EventKey(event.timestamp, running.process_id);
+    if (stepBatching && event.timestamp > currentTime)
+    {
+        // The event cannot fire during this time step, and a preemption later in the step may still cancel it.
+        deferredEvents[cpuIndex] = event;
+        hasDeferredEvent[cpuIndex] = true;
     }
     else
     {
-        if (algorithmType == "Priority" && arrivalEvent.process.priority < cpu.getRunningProcess()->priority)
+        eventQueue->push(event);
+    }
+}
+
+void Scheduler::handleArrivalEvent(const Event &arrivalEvent, const int &currentTime)
+{
+    Process p = arrivalEvent.process;
+    if (p.period > 0 && p.arrival_time + p.period < releaseHorizon)
+    {
+        // Periodic tasks release their next job lazily, one arrival at a time.
+        Process nextJob = p;
+        nextJob.process_id = nextJobId++;
+        nextJob.arrival_time = p.arrival_time + p.period;
+        nextJob.ready_time = nextJob.arrival_time;
+        nextJob.absolute_deadline = nextJob.arrival_time + p.deadline;
+        eventQueue->push(Event(Event::ARRIVAL, nextJob.arrival_time, nextJob));
+    }
+
+    if (boundedQueue != nullptr && !boundedQueue->takeToken(currentTime))
+    {
+        // Rate-limited arrivals never enter the system.
+        return;
+    }
+    if (memory != nullptr)
+    {
+        // The process is blocked on memory until its demand fits.
+        std::vector<Process> admitted = memory->request(p, currentTime);
+        admitProcesses(admitted, currentTime);
+        return;
+    }
+    if (trackShares)
+    {
+        enterRunnable(p);
+    }
+    makeReady(p, currentTime);
+}
+
+void Scheduler::admitProcesses(std::vector<Process> &admitted, const int &currentTime)
+{
+    for (Process &p : admitted)
+    {
+        // Only the time spent waiting for a CPU counts as waiting time.
+        p.ready_time = currentTime;
+        if (trackShares)
+        {
+            enterRunnable(p);
+        }
+        makeReady(p, currentTime);
+    }
+}
+
+void Scheduler::makeReady(const Process &p, const int &currentTime)
+{
+    int idleCPU = selectIdleCPU(p);
+    if (idleCPU >= 0)
+    {
+        dispatchProcess(p, idleCPU, currentTime);
+        return;
+    }
+
+    // Every CPU is busy: under a preemptive algorithm the process may replace the least urgent running process.
+    int victim = 0;
+    for (size_t i = 1; preemptive && i < cpus.size(); i++)
+    {
+        if (readyQueue->preempts(*cpus[victim].getRunningProcess(), *cpus[i].getRunningProcess()))
         {
-            // Preemption logic:
-            Process preemptedProcess = cpu.unloadProcess(currentTime);
-            readyQueue->addProcess(preemptedProcess);
-            EventKey preemptKey(preemptedProcess.completion_time, preemptedProcess.process_id);
-            eventQueue.remove(preemptKey);
-            int completionTime = cpu.loadProcess(arrivalEvent.process, currentTime);
-            eventQueue.push(Event(Event::COMPLETION, completionTime, arrivalEvent.process));
+            victim = static_cast<int>(i);
+        }
+    }
+
+    if (preemptive && readyQueue->preempts(p, *cpus[victim].getRunningProcess()))
+    {
+        // Preemption logic:
+        flushReadyBatch();
+        Process preemptedProcess = unloadFromCPU(victim, currentTime);
+        readyQueue->addProcess(preemptedProcess);
+        if (hasDeferredEvent[victim])
+        {
+            hasDeferredEvent[victim] = false;
         }
         else
         {
+            eventQueue->remove(pendingEvents[victim]);
+        }
+        dispatchProcess(p, victim, currentTime);
+    }
+    else if (stepBatching && boundedQueue == nullptr)
+    {
+        // Admission control looks at the queue, so only unbounded queues defer their insertions.
+        readyBatch.push_back(p);
+    }
+    else if (p.hasStarted || admitToQueue(p))
+    {
+        readyQueue->addProcess(p);
+    }
+}
+
+bool Scheduler::admitToQueue(const Process &p)
+{
+    if (boundedQueue == nullptr)
+    {
+        return true;
+    }
 
-            readyQueue->addProcess(arrivalEvent.process);
+    std::vector<Process> dropped;
+    bool admitted = boundedQueue->makeRoom(p, dropped);
+    for (Process &shedProcess : dropped)
+    {
+        shedWork += shedProcess.completed_burst_time;
+        if (trackShares)
+        {
+            leaveRunnable(shedProcess);
         }
     }
+    if (!admitted && trackShares)
+    {
+        Process rejected = p;
+        leaveRunnable(rejected);
+    }
+    return admitted;
 }
 
 void Scheduler::handleCompletionEvent(const Event &completionEvent, const int &currentTime)
@@ -138,14 +505,37 @@ void Scheduler::handleCompletionEvent(const Event &completionEvent, const int &c
 
     try
     {
+        CPU &cpu = cpus[completionEvent.cpu];
         if (cpu.getRunningProcess()->process_id == completionEvent.process.process_id)
         {
-            completedProcesses.push_back(cpu.unloadProcess(currentTime));
+            Process finishedProcess = unloadFromCPU(completionEvent.cpu, currentTime);
+            if (adaptiveQuantum != nullptr)
+            {
+                // The burst ran to its end, so its whole length counts, however many slices it took.
+                quantum = adaptiveQuantum->record(finishedProcess.burst_time, currentTime);
+            }
+            if (trackShares)
+            {
+                leaveRunnable(finishedProcess);
+            }
+            bool finished = finishedProcess.next_phase >= finishedProcess.phase_count;
+            if (finished)
+            {
+                completedProcesses.push_back(finishedProcess);
+            }
+            else
+            {
+                requestIO(finishedProcess, currentTime);
+            }
             if (!readyQueue->isEmpty())
             {
-                Process nextProcess = readyQueue->getNextProcess();
-                int nextCompletionTime = cpu.loadProcess(nextProcess, currentTime);
-                eventQueue.push(Event(Event::COMPLETION, nextCompletionTime, nextProcess));
+                dispatchProcess(readyQueue->getNextProcess(), completionEvent.cpu, currentTime);
+            }
+            if (finished && memory != nullptr)
+            {
+                // Processes that were ready first get the CPU before the ones admitted now.
+                std::vector<Process> admitted = memory->release(finishedProcess, currentTime);
+                admitProcesses(admitted, currentTime);
             }
         }
     }
@@ -155,6 +545,270 @@ void Scheduler::handleCompletionEvent(const Event &completionEvent, const int &c
     }
 }
 
+void Scheduler::handleQuantumExpiredEvent(const Event &quantumEvent, const int &currentTime)
+{
+    CPU &cpu = cpus[quantumEvent.cpu];
+    if (cpu.isIdle() || cpu.getRunningProcess()->process_id != quantumEvent.process.process_id)
+    {
+        return;
+    }
+
+    if (readyQueue->isEmpty())
+    {
+        // Nobody is waiting for the CPU, so the process keeps running without a context switch.
+        const Process &running = *cpu.getRunningProcess();
+        scheduleNextEvent(running, quantumEvent.cpu, currentTime, running.completion_time);
+        return;
+    }
+
+    Process preemptedProcess = unloadFromCPU(quantumEvent.cpu, currentTime);
+    readyQueue->addProcess(preemptedProcess);
+    dispatchProcess(readyQueue->getNextProcess(), quantumEvent.cpu, currentTime);
+}
+
+Process Scheduler::unloadFromCPU(int cpuIndex, const int &currentTime)
+{
+    Process p = cpus[cpuIndex].unloadProcess(currentTime);
+    readyQueue->chargeUsage(p, currentTime - p.start_time);
+    return p;
+}
+
+void Scheduler::advanceVirtualTime(const int &currentTime)
+{
+    if (runnableTickets > 0)
+    {
+        int busyCPUs = std::count_if(cpus.begin(), cpus.end(), [](const CPU &cpu)
+                                     { return !cpu.isIdle(); });
+        virtualTime += static_cast<double>(currentTime - virtualTimeUpdated) * busyCPUs / runnableTickets;
+    }
+    virtualTimeUpdated = currentTime;
+}
+
+void Scheduler::enterRunnable(Process &p)
+{
+    p.share_start = virtualTime;
+    runnableTickets += std::max(1, p.tickets);
+}
+
+void Scheduler::leaveRunnable(Process &p)
+{
+    p.share_ideal += std::max(1, p.tickets) * (virtualTime - p.share_start);
+    runnableTickets -= std::max(1, p.tickets);
+}
+
+void Scheduler::requestIO(const Process &p, const int &currentTime)
+{
+    int deviceIndex = p.process_id % static_cast<int>(devices.size());
+    IODevice &device = devices[deviceIndex];
+
+    device.waiting.push_back(p);
+    if (!device.busy)
+    {
+        device.busy = true;
+        Event start(Event::IO_START, currentTime, p);
+        start.device = deviceIndex;
+        eventQueue->push(start);
+    }
+}
+
+void Scheduler::handleIOStartEvent(const Event &ioEvent, const int &currentTime)
+{
+    IODevice &device = devices[ioEvent.device];
+    Process p = device.waiting.front();
+    device.waiting.pop_front();
+
+    int length = phaseTable[p.phase_offset + p.next_phase];
+    device.busyTime += length;
+    device.requests++;
+
+    Event completion(Event::IO_COMPLETION, currentTime + length, p);
+    completion.device = ioEvent.device;
+    eventQueue->push(completion);
+}
+
+void Scheduler::handleIOCompletionEvent(const Event &ioEvent, const int &currentTime)
+{
+    IODevice &device = devices[ioEvent.device];
+    if (device.waiting.empty())
+    {
+        device.busy = false;
+    }
+    else
+    {
+        Event start(Event::IO_START, currentTime, device.waiting.front());
+        start.device = ioEvent.device;
+        eventQueue->push(start);
+    }
+
+    // The process moves on to its next CPU burst and becomes ready again.
+    Process p = ioEvent.process;
+    p.burst_time = phaseTable[p.phase_offset + p.next_phase + 1];
+    p.completed_burst_time = 0;
+    p.next_phase += 2;
+    p.ready_time = currentTime;
+    if (trackShares)
+    {
+        enterRunnable(p);
+    }
+    makeReady(p, currentTime);
+}
+
+long long Scheduler::getEventCount() const
+{
+    return eventCount;
+}
+
+void Scheduler::recordDispatches()
+{
+    logDispatches = true;
+}
+
+const std::vector<Scheduler::Dispatch> &Scheduler::getDispatches() const
+{
+    return dispatches;
+}
+
+void Scheduler::setCheckpoint(Checkpoint *checkpoint, int time)
+{
+    this->checkpoint = checkpoint;
+    checkpointTime = time;
+}
+
+void Scheduler::saveState(std::ostream &out)
+{
+    // The event count is not saved: it measures the work of this run.
+    Checkpoint::write(out, currentTime);
+
+    // Completed processes make up most of a checkpoint, so only the fields their statistics use are written.
+    Checkpoint::write<uint64_t>(out, completedProcesses.size());
+    for (const Process &p : completedProcesses)
+    {
+        Checkpoint::write(out, p.process_id);
+        Checkpoint::write(out, p.arrival_time);
+        Checkpoint::write(out, p.burst_time);
+        Checkpoint::write(out, p.completion_time);
+        Checkpoint::write(out, p.wait_time);
+        Checkpoint::write(out, p.response_time);
+        Checkpoint::write(out, p.absolute_deadline);
+    }
+
+    Checkpoint::write<uint64_t>(out, cpus.size());
+    for (size_t i = 0; i < cpus.size(); i++)
+    {
+        cpus[i].saveState(out);
+        Checkpoint::write(out, pendingEvents[i].first);
+        Checkpoint::write(out, pendingEvents[i].second);
+    }
+
+    // The queues are drained in order and refilled in the same order.
+    std::vector<Process> ready;
+    while (!readyQueue->isEmpty())
+    {
+        ready.push_back(readyQueue->getNextProcess());
+    }
+    Checkpoint::write<uint64_t>(out, ready.size());
+    for (const Process &p : ready)
+    {
+        Checkpoint::writeProcess(out, p);
+        readyQueue->addProcess(p);
+    }
+
+    std::vector<Event> events;
+    while (!eventQueue->empty())
+    {
+        events.push_back(eventQueue->top());
+        eventQueue->pop();
+    }
+    Checkpoint::write<uint64_t>(out, events.size());
+    for (const Event &event : events)
+    {
+        Checkpoint::write(out, static_cast<int>(event.type));
+        Checkpoint::write(out, event.timestamp);
+        Checkpoint::write(out, event.cpu);
+        Checkpoint::writeProcess(out, event.process);
+        eventQueue->push(event);
+    }
+}
+
+void Scheduler::restoreState(std::istream &in)
+{
+    currentTime = Checkpoint::read<int>(in);
+
+    completedProcesses.resize(Checkpoint::read<uint64_t>(in));
+    for (Process &p : completedProcesses)
+    {
+        p.process_id = Checkpoint::read<int>(in);
+        p.arrival_time = Checkpoint::read<int>(in);
+        p.burst_time = Checkpoint::read<int>(in);
+        p.completion_time = Checkpoint::read<int>(in);
+        p.wait_time = Checkpoint::read<int>(in);
+        p.response_time = Checkpoint::read<int>(in);
+        p.absolute_deadline = Checkpoint::read<int>(in);
+    }
+
+    if (Checkpoint::read<uint64_t>(in) != cpus.size())
+    {
+        throw std::runtime_error("The checkpoint was taken on a different number of CPUs");
+    }
+    for (size_t i = 0; i < cpus.size(); i++)
+    {
+        cpus[i].restoreState(in);
+        pendingEvents[i].first = Checkpoint::read<int>(in);
+        pendingEvents[i].second = Checkpoint::read<int>(in);
+    }
+
+    for (uint64_t count = Checkpoint::read<uint64_t>(in); count > 0; count--)
+    {
+        readyQueue->addProcess(Checkpoint::readProcess(in));
+    }
+
+    for (uint64_t count = Checkpoint::read<uint64_t>(in); count > 0; count--)
+    {
+        Event::EventType type = static_cast<Event::EventType>(Checkpoint::read<int>(in));
+        int timestamp = Checkpoint::read<int>(in);
+        int cpu = Checkpoint::read<int>(in);
+        Event event(type, timestamp, Checkpoint::readProcess(in));
+        event.cpu = cpu;
+        eventQueue->push(event);
+    }
+}
+
+Statistics Scheduler::getStatistics() const
+{
+    return summarize(ProcessColumns::fromProcesses(completedProcesses));
+}
+
+Statistics Scheduler::summarize(const ProcessColumns &columns) const
+{
+    Statistics statistics;
+    long long totalBusyTime = 0;
+    for (const CPU &cpu : cpus)
+    {
+        totalBusyTime += cpu.getTotalBusyTime();
+        statistics.contextSwitches += cpu.getContextSwitchCount();
+    }
+
+    statistics.processes = columns.size();
+    if (statistics.processes == 0)
+    {
+        return statistics;
+    }
+
+    statistics.elapsedTime = completedProcesses.back().completion_time; // Assuming last process has the latest completion time
+    double capacity = static_cast<double>(statistics.elapsedTime) * cpus.size();
+    statistics.throughput = static_cast<double>(statistics.processes) / statistics.elapsedTime;
+    statistics.cpuUtilization = (static_cast<double>(totalBusyTime) / capacity) * 100.0;
+    statistics.avgWaitingTime = static_cast<double>(columnSum(columns.wait)) / statistics.processes;
+    statistics.avgTurnaroundTime = static_cast<double>(columnSum(columns.turnaround)) / statistics.processes;
+    statistics.avgResponseTime = static_cast<double>(columnSum(columns.response)) / statistics.processes;
+
+    std::vector<int> values = columns.response;
+    statistics.p99ResponseTime = percentile(values, 0.99);
+    values = columns.turnaround;
+    statistics.p99TurnaroundTime = percentile(values, 0.99);
+    return statistics;
+}
+
 void Scheduler::printStatistics(const std::string& input_filename) const
 {
 
@@ -166,25 +820,30 @@ void Scheduler::printStatistics(const std::string& input_filename) const
         throw std::runtime_error("Error opening output file: " + outputFileName);
     }
 
-    int numProcesses = completedProcesses.size();
-    int totalElapsedTime = completedProcesses.back().completion_time; // Assuming last process has the latest completion time
-    double throughput = static_cast<double>(numProcesses) / totalElapsedTime;
-    double cpuUtilization = (static_cast<double>(cpu.getTotalBusyTime()) / totalElapsedTime) * 100.0;
-
-    int totalWaitingTime = 0;
-    int totalTurnaroundTime = 0;
-    int totalResponseTime = 0;
-
-    for (const Process &p : completedProcesses)
+    long long totalBusyTime = 0;
+    long long totalSwitchTime = 0;
+    long long totalWakeTime = 0;
+    int contextSwitches = 0;
+    int warmSwitches = 0;
+    for (const CPU &cpu : cpus)
     {
-        totalWaitingTime += p.wait_time;
-        totalTurnaroundTime += p.completion_time - p.arrival_time;
-        totalResponseTime += p.response_time;
+        totalBusyTime += cpu.getTotalBusyTime();
+        totalSwitchTime += cpu.getTotalSwitchTime();
+        totalWakeTime += cpu.getTotalWakeTime();
+        contextSwitches += cpu.getContextSwitchCount();
+        warmSwitches += cpu.getWarmSwitchCount();
     }
 
-    double avgWaitingTime = static_cast<double>(totalWaitingTime) / numProcesses;
-    double avgTurnaroundTime = static_cast<double>(totalTurnaroundTime) / numProcesses;
-    double avgResponseTime = static_cast<double>(totalResponseTime) / numProcesses;
+    ProcessColumns columns = ProcessColumns::fromProcesses(completedProcesses);
+    Statistics statistics = summarize(columns);
+    int numProcesses = statistics.processes;
+    int totalElapsedTime = statistics.elapsedTime;
+    double capacity = static_cast<double>(totalElapsedTime) * cpus.size();
+    double throughput = statistics.throughput;
+    double cpuUtilization = statistics.cpuUtilization;
+    double avgWaitingTime = statistics.avgWaitingTime;
+    double avgTurnaroundTime = statistics.avgTurnaroundTime;
+    double avgResponseTime = statistics.avgResponseTime;
 
     outputFile << "\n----------------- Statistics -----------------\n";
     outputFile << "Number of processes: " << numProcesses << std::endl;
@@ -194,9 +853,183 @@ void Scheduler::printStatistics(const std::string& input_filename) const
     outputFile << "Average waiting time (CPU burst times): " << avgWaitingTime << std::endl;
     outputFile << "Average turnaround time (CPU burst times): " << avgTurnaroundTime << std::endl;
     outputFile << "AAverage response time (CPU burst times): " << avgResponseTime << std::endl;
+    if (reportSwitching)
+    {
+        double effectiveUtilization = capacity > 0 ? static_cast<double>(totalBusyTime - totalSwitchTime - totalWakeTime) / capacity * 100.0 : 0.0;
+
+        outputFile << "Time quantum: " << (quantum > 0 ? std::to_string(quantum) : "none") << std::endl;
+        outputFile << "Context switches: " << contextSwitches << " (" << warmSwitches << " with a warm cache)" << std::endl;
+        outputFile << "Context switch overhead (CPU burst times): " << totalSwitchTime << std::endl;
+        outputFile << "Effective CPU utilization (excluding switch overhead): " << effectiveUtilization << "%" << std::endl;
+    }
+    if (adaptiveQuantum != nullptr)
+    {
+        outputFile << "Adaptive quantum: p" << adaptiveQuantum->getPercentile() << " of completed CPU bursts, retuned every "
+                   << adaptiveQuantum->getRetuneInterval() << " bursts (" << adaptiveQuantum->getRetuneCount() << " retunes)" << std::endl;
+        outputFile << "Quantum over time:\n";
+        outputFile << "time quantum\n";
+        for (const auto &change : adaptiveQuantum->getHistory())
+        {
+            outputFile << change.first << " " << change.second << "\n";
+        }
+    }
+    if (trackShares)
+    {
+        std::vector<int> absoluteLag;
+        double totalLag = 0.0;
+        double totalIdeal = 0.0;
+        for (const Process &p : completedProcesses)
+        {
+            double lag = std::abs(p.cpu_time - p.share_ideal);
+            absoluteLag.push_back(static_cast<int>(std::lround(lag)));
+            totalLag += lag;
+            totalIdeal += p.share_ideal;
+        }
+
+        outputFile << "Share lag vs. ideal proportional share, mean/p99/max (CPU burst times): " << (numProcesses > 0 ? totalLag / numProcesses : 0.0)
+                   << " / " << percentile(absoluteLag, 0.99) << " / " << percentile(absoluteLag, 1.0) << std::endl;
+        outputFile << "Relative share error: " << (totalIdeal > 0.0 ? totalLag / totalIdeal : 0.0) << std::endl;
+    }
+
+    if (!groupNames.empty())
+    {
+        std::vector<long long> groupCPUTime(groupNames.size(), 0);
+        std::vector<long long> groupWaitingTime(groupNames.size(), 0);
+        std::vector<int> groupProcesses(groupNames.size(), 0);
+        long long totalCPUTime = 0;
+        for (const Process &p : completedProcesses)
+        {
+            groupCPUTime[p.group] += p.cpu_time;
+            groupWaitingTime[p.group] += p.wait_time;
+            groupProcesses[p.group]++;
+            totalCPUTime += p.cpu_time;
+        }
+
+        outputFile << "group processes cpu_share(%) avg_waiting_time throughput\n";
+        for (size_t g = 0; g < groupNames.size(); g++)
+        {
+            outputFile << groupNames[g] << " " << groupProcesses[g] << " "
+                       << (totalCPUTime > 0 ? static_cast<double>(groupCPUTime[g]) / totalCPUTime * 100.0 : 0.0) << " "
+                       << (groupProcesses[g] > 0 ? static_cast<double>(groupWaitingTime[g]) / groupProcesses[g] : 0.0) << " "
+                       << (totalElapsedTime > 0 ? static_cast<double>(groupProcesses[g]) / totalElapsedTime : 0.0) << "\n";
+        }
+    }
+
+    std::vector<int> lateness;
+    for (const Process &p : completedProcesses)
+    {
+        if (p.absolute_deadline >= 0)
+        {
+            lateness.push_back(p.completion_time - p.absolute_deadline);
+        }
+    }
+    if (!lateness.empty())
+    {
+        int misses = std::count_if(lateness.begin(), lateness.end(), [](int late)
+                                   { return late > 0; });
+
+        outputFile << "Jobs with deadlines: " << lateness.size() << std::endl;
+        outputFile << "Deadline misses: " << misses << std::endl;
+        outputFile << "Deadline miss ratio: " << static_cast<double>(misses) / lateness.size() << std::endl;
+        outputFile << "Lateness p50/p95/p99/max: " << percentile(lateness, 0.50) << " / " << percentile(lateness, 0.95)
+                   << " / " << percentile(lateness, 0.99) << " / " << percentile(lateness, 1.0) << std::endl;
+    }
+    if (!phaseTable.empty())
+    {
+        long long deviceBusyTime = 0;
+        int ioRequests = 0;
+        for (const IODevice &device : devices)
+        {
+            deviceBusyTime += device.busyTime;
+            ioRequests += device.requests;
+        }
+
+        double deviceCapacity = static_cast<double>(totalElapsedTime) * devices.size();
+
+        outputFile << "I/O devices: " << devices.size() << std::endl;
+        outputFile << "I/O operations: " << ioRequests << std::endl;
+        outputFile << "I/O device utilization: " << (deviceCapacity > 0 ? deviceBusyTime / deviceCapacity * 100.0 : 0.0) << "%" << std::endl;
+    }
+    if (boundedQueue != nullptr)
+    {
+        long long totalWork = -shedWork;
+        for (const CPU &cpu : cpus)
+        {
+            totalWork += cpu.getTotalWork();
+        }
+        std::vector<int> waitingTimes = columns.wait;
+
+        outputFile << "Admission policy: " << boundedQueue->getPolicy() << " (queue capacity "
+                   << (boundedQueue->getCapacity() > 0 ? std::to_string(boundedQueue->getCapacity()) : "unlimited") << ")" << std::endl;
+        outputFile << "Rejected arrivals (queue full): " << boundedQueue->getRejectedCount() << std::endl;
+        outputFile << "Rejected arrivals (rate-limited): " << boundedQueue->getRateLimitedCount() << std::endl;
+        outputFile << "Shed from the ready queue: " << boundedQueue->getShedCount() << std::endl;
+        outputFile << "Goodput (work of completed processes per CPU burst time): " << (totalElapsedTime > 0 ? static_cast<double>(totalWork) / totalElapsedTime : 0.0) << std::endl;
+        outputFile << "Waiting time p50/p99/max: " << percentile(waitingTimes, 0.50) << " / " << percentile(waitingTimes, 0.99)
+                   << " / " << percentile(waitingTimes, 1.0) << std::endl;
+    }
+    if (memory != nullptr)
+    {
+        std::vector<int> memoryWaits;
+        long long totalMemoryWait = 0;
+        for (const Process &p : completedProcesses)
+        {
+            memoryWaits.push_back(p.memory_wait);
+            totalMemoryWait += p.memory_wait;
+        }
+        int blocked = std::count_if(memoryWaits.begin(), memoryWaits.end(), [](int wait)
+                                    { return wait > 0; });
+
+        double memoryCapacity = static_cast<double>(totalElapsedTime) * memory->getCapacity();
+        double memoryUtilization = memoryCapacity > 0 ? memory->getUsageTime(totalElapsedTime) / memoryCapacity * 100.0 : 0.0;
+        double avgMemoryWait = numProcesses > 0 ? static_cast<double>(totalMemoryWait) / numProcesses : 0.0;
+
+        outputFile << "Memory capacity: " << memory->getCapacity() << " (policy: " << memory->getPolicy() << ")" << std::endl;
+        outputFile << "Peak memory in use: " << memory->getPeakUsage() << std::endl;
+        outputFile << "Memory utilization: " << memoryUtilization << "%" << std::endl;
+        outputFile << "Processes blocked on memory: " << blocked << std::endl;
+        outputFile << "Average time blocked on memory (CPU burst times): " << avgMemoryWait << std::endl;
+        outputFile << "Average time waiting for a CPU (CPU burst times): " << avgWaitingTime << std::endl;
+        outputFile << "Memory wait p50/p99/max: " << percentile(memoryWaits, 0.50) << " / " << percentile(memoryWaits, 0.99)
+                   << " / " << percentile(memoryWaits, 1.0) << std::endl;
+    }
+    if (reportEnergy)
+    {
+        double totalEnergy = 0.0;
+        for (const CPU &cpu : cpus)
+        {
+            totalEnergy += cpu.getEnergy(totalElapsedTime);
+        }
+
+        outputFile << "CPUs: " << cpus.size() << " (placement: " << placement << ")" << std::endl;
+        outputFile << "Wake-up latency (CPU burst times): " << totalWakeTime << std::endl;
+        outputFile << "Energy: " << totalEnergy << std::endl;
+        outputFile << "Average power: " << (totalElapsedTime > 0 ? totalEnergy / totalElapsedTime : 0.0) << std::endl;
+        outputFile << "Processes per unit of energy: " << (totalEnergy > 0.0 ? numProcesses / totalEnergy : 0.0) << std::endl;
+        outputFile << "cpu speed busy_time work utilization(%) energy\n";
+        for (const CPU &cpu : cpus)
+        {
+            outputFile << cpu.getId() << " " << cpu.getType().speed << " " << cpu.getTotalBusyTime() << " " << cpu.getTotalWork() << " "
+                       << (totalElapsedTime > 0 ? static_cast<double>(cpu.getTotalBusyTime()) / totalElapsedTime * 100.0 : 0.0)
+                       << " " << cpu.getEnergy(totalElapsedTime) << "\n";
+        }
+    }
     outputFile << "---------------------------------------------\n";
 
     std::cout << "Statistics output to "<< outputFileName << std::endl;
 
     outputFile.close();
+
+    if (!exportFile.empty())
+    {
+        if (exportFormat == "csv")
+        {
+            columns.writeCSV(exportFile);
+        }
+        else
+        {
+            columns.writeColumnar(exportFile);
+        }
+        std::cout << "Per-process results exported to " << exportFile << std::endl;
+    }
 }
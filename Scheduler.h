@@ -15,6 +15,17 @@
 #include "EventQueue.h"
 #include "Event.h"
 #include "Process.h"
+#include "Options.h"
+#include "Workload.h"
+#include "IODevice.h"
+#include "HierarchicalQueue.h"
+#include "BoundedReadyQueue.h"
+#include "MemoryManager.h"
+#include "AdaptiveQuantum.h"
+#include "Metrics.h"
+#include "ProcessColumns.h"
+#include "Checkpoint.h"
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -27,19 +38,57 @@
  */
 class Scheduler {
 public:
+    /**
+     * @brief A process being put on a CPU, as recorded by the dispatch log.
+     */
+    struct Dispatch
+    {
+        int time;      /**< @brief The time of the dispatch. */
+        int cpu;       /**< @brief The CPU the process was put on. */
+        int processId; /**< @brief The ID of the dispatched process. */
+    };
+
     /**
      * @brief Constructs a new `Scheduler` object.
      * 
      * @param fileName The name of the input file containing process data.
-     * @param algorithmType The type of scheduling algorithm to use ("FIFO", "SJF", or "Priority").
+     * @param algorithmType The type of scheduling algorithm to use ("FIFO", "SJF", "Priority", "RR", "AdaptiveRR", "EDF",
+     *                      "RM", "Stride", "Lottery", or "Group").
+     * @param options The optional simulation settings.
      */
-    Scheduler(const std::string& fileName, const std::string& algorithmType);
+    Scheduler(const std::string& fileName, const std::string& algorithmType, const Options& options = Options());
+
+    /**
+     * @brief Constructs a new `Scheduler` object for an already loaded workload.
+     *
+     * The workload is only read, so one workload can be shared by many schedulers,
+     * including schedulers running concurrently on different threads.
+     * 
+     * @param workload The workload to simulate (at most `options.maxProcesses` of its processes are used).
+     * @param algorithmType The type of scheduling algorithm to use (see above).
+     * @param options The optional simulation settings.
+     */
+    Scheduler(const Workload& workload, const std::string& algorithmType, const Options& options = Options());
+
+    /**
+     * @brief Destroys the `Scheduler` object and its ready queue.
+     */
+    ~Scheduler();
+
+    Scheduler(const Scheduler&) = delete;
+    Scheduler& operator=(const Scheduler&) = delete;
 
     /**
      * @brief Runs the process scheduling simulation.
      *
      * This method initializes the simulation, loads processes from the input file,
      * and then processes events (arrivals and completions) until all processes are completed.
+     *
+     * Events are handled one time step at a time. Within a step, processes that only join the
+     * ready queue are inserted as one batch (see `ReadyQueue::addProcesses`) just before the
+     * queue is next read, and the completion or time-slice events of dispatched processes are
+     * pushed once the step ends, so that a process preempted later in the same step never puts
+     * its event on the event queue. The schedule is the same as handling events one at a time.
      */
     void runSimulation();
 
@@ -56,28 +105,183 @@ public:
      *   - Average response time (in CPU time units)
      *
      * The statistics are written to a text file with the same name as the input file, 
-     * but with "-output.txt" appended to the filename.
+     * but with "-output.txt" appended to the filename. With the `--export` option, the
+     * per-process results are also exported (see `ProcessColumns`).
      *
      * @param input_filename The name of the input file used for the simulation.
      * @throws std::runtime_error if the output file cannot be opened.
      */
     void printStatistics(const std::string& input_filename) const;
+
+    /**
+     * @brief Computes the summary metrics of the simulation.
+     *
+     * @return The metrics of the completed processes (all zero if none completed).
+     */
+    Statistics getStatistics() const;
+
+    /**
+     * @brief Gets the number of events processed by `runSimulation`.
+     */
+    long long getEventCount() const;
+
+    /**
+     * @brief Makes `runSimulation` record every dispatch (off by default, as the log grows with the run).
+     */
+    void recordDispatches();
+
+    /**
+     * @brief Gets the dispatches recorded by `runSimulation`, in order.
+     */
+    const std::vector<Dispatch>& getDispatches() const;
+
+    /**
+     * @brief Makes `runSimulation` save a checkpoint just before it handles the first event at or after a time.
+     *
+     * @param checkpoint The checkpoint receiving the state.
+     * @param time The checkpoint time.
+     */
+    void setCheckpoint(Checkpoint* checkpoint, int time);
+
+    /**
+     * @brief Writes the simulation state to a checkpoint.
+     *
+     * The pending events and ready processes are written in the order they would be handled,
+     * so restoring them reproduces that order. Only the state used by the algorithms and
+     * features that `Checkpoint` supports is written.
+     *
+     * @param out The checkpoint stream.
+     */
+    void saveState(std::ostream& out);
+
+    /**
+     * @brief Restores the simulation state written by `saveState`, on top of the loaded processes.
+     *
+     * @param in The checkpoint stream.
+     * @throws std::runtime_error if the checkpoint is truncated or was taken on other CPUs.
+     */
+    void restoreState(std::istream& in);
 private:
     /**
-     * @brief Loads processes from the specified file into the event queue.
+     * @brief Computes the summary metrics from the per-process columns of the completed processes.
      * 
-     * @param fileName The name of the input file containing process data.
+     * @param columns The per-process results.
+     * @return The summary metrics.
      */
-    void loadProcessesFromFile(const std::string& fileName);
+    Statistics summarize(const ProcessColumns& columns) const;
+
+
+    /**
+     * @brief Loads the processes of a workload into the event queue as arrival events
+     *        and copies its phase table and group names.
+     * 
+     * @param workload The workload read from the input file.
+     * @param maxProcesses The number of leading processes to load (0 for all).
+     */
+    void loadProcesses(const Workload& workload, int maxProcesses);
+
+    /**
+     * @brief Gives a ready process a CPU, or adds it to the ready queue.
+     *
+     * The process is loaded onto an idle CPU if there is one; under a preemptive algorithm it
+     * may instead replace the least urgent running process (see `ReadyQueue::preempts`).
+     * 
+     * Without admission control, a process that only joins the queue is added to `readyBatch`.
+     *
+     * @param p The process that became ready (arrived or finished an I/O phase).
+     * @param currentTime The current simulation time.
+     */
+    void makeReady(const Process& p, const int& currentTime);
+
+    /**
+     * @brief Applies the admission policy to an arrival that has to wait in the ready queue.
+     *
+     * Processes shed to make room, and a rejected arrival, leave the system.
+     * 
+     * @param p The arriving process.
+     * @return True if the process may be added to the ready queue.
+     */
+    bool admitToQueue(const Process& p);
+
+    /**
+     * @brief Unloads the process running on a CPU and charges its CPU usage to the ready queue.
+     * 
+     * @param cpuIndex The index of the CPU.
+     * @param currentTime The current simulation time.
+     * @return The unloaded process.
+     */
+    Process unloadFromCPU(int cpuIndex, const int& currentTime);
+
+    /**
+     * @brief Advances the virtual time of the ideal proportional-share (fluid) schedule.
+     *
+     * In the ideal schedule, the capacity of the busy CPUs is divided among all runnable
+     * processes in proportion to their tickets, so one unit of virtual time is worth one unit
+     * of CPU time per ticket. A process's ideal CPU time is then its tickets times the virtual
+     * time that passed while it was runnable, which costs O(1) per event to maintain.
+     * 
+     * @param currentTime The current simulation time.
+     */
+    void advanceVirtualTime(const int& currentTime);
+
+    /**
+     * @brief Records that a process became runnable, for share tracking.
+     * 
+     * @param p The process that arrived or finished an I/O phase.
+     */
+    void enterRunnable(Process& p);
+
+    /**
+     * @brief Records that a process stopped being runnable and credits its ideal CPU time.
+     * 
+     * @param p The process that completed or started an I/O phase.
+     */
+    void leaveRunnable(Process& p);
+
+    /**
+     * @brief Queues a process that finished a CPU burst on the I/O device serving it.
+     *
+     * Processes are spread over the devices by process ID.
+     * 
+     * @param p The process starting its next I/O phase.
+     * @param currentTime The current simulation time.
+     */
+    void requestIO(const Process& p, const int& currentTime);
+
+    /**
+     * @brief Handles a device starting to serve the first process in its queue.
+     * 
+     * @param ioEvent The `Event` object representing the start of the I/O phase.
+     * @param currentTime The current simulation time.
+     */
+    void handleIOStartEvent(const Event& ioEvent, const int& currentTime);
+
+    /**
+     * @brief Handles the end of an I/O phase; the process becomes ready for its next CPU burst.
+     * 
+     * @param ioEvent The `Event` object representing the end of the I/O phase.
+     * @param currentTime The current simulation time.
+     */
+    void handleIOCompletionEvent(const Event& ioEvent, const int& currentTime);
 
     /**
      * @brief Handles the arrival of a new process.
+     *
+     * The arrival of a periodic task's job also schedules the arrival of its next job.
      * 
      * @param arrivalEvent The `Event` object representing the process arrival.
      * @param currentTime The current simulation time.
      */
     void handleArrivalEvent(const Event& arrivalEvent, const int& currentTime);
 
+    /**
+     * @brief Makes processes that were just given their memory ready.
+     *
+     * @param admitted The admitted processes, in admission order.
+     * @param currentTime The current simulation time.
+     */
+    void admitProcesses(std::vector<Process>& admitted, const int& currentTime);
+
     /**
      * @brief Handles the completion of a process.
      * 
@@ -86,12 +290,112 @@ private:
      */
     void handleCompletionEvent(const Event& completionEvent, const int& currentTime);
 
+    /**
+     * @brief Handles the end of the running process's time slice.
+     *
+     * The process is moved back to the ready queue and the next process is loaded,
+     * unless no other process is waiting, in which case it keeps the CPU.
+     * 
+     * @param quantumEvent The `Event` object representing the end of the time slice.
+     * @param currentTime The current simulation time.
+     */
+    void handleQuantumExpiredEvent(const Event& quantumEvent, const int& currentTime);
+
+    /**
+     * @brief Chooses an idle CPU for a process according to the placement policy.
+     *
+     * Placement policies:
+     *   - "first": the idle CPU with the lowest index.
+     *   - "fastest": the fastest idle CPU.
+     *   - "size": the fastest idle CPU for bursts of at least `bigBurstThreshold`, and
+     *     the most energy-efficient idle CPU (lowest active power per unit of speed) otherwise.
+     * 
+     * @param p The process to place.
+     * @return The index of the chosen CPU, or -1 if every CPU is busy.
+     */
+    int selectIdleCPU(const Process& p) const;
+
+    /**
+     * @brief Loads a process onto a CPU and schedules its completion or time-slice event.
+     * 
+     * @param p The process to load.
+     * @param cpuIndex The index of the CPU to load the process onto.
+     * @param currentTime The current simulation time.
+     */
+    void dispatchProcess(const Process& p, int cpuIndex, const int& currentTime);
+
+    /**
+     * @brief Adds the processes of `readyBatch` to the ready queue.
+     */
+    void flushReadyBatch();
+
+    /**
+     * @brief Pushes the events of `deferredEvents` onto the event queue.
+     */
+    void flushDeferredEvents();
+
+    /**
+     * @brief Schedules the next event of a running process and remembers its key in `pendingEvents`.
+     *
+     * A `QUANTUM_EXPIRED` event is scheduled if the process cannot finish within one quantum
+     * of `sliceStart`, and a `COMPLETION` event otherwise. An event after the current time is
+     * held in `deferredEvents` until the end of the time step.
+     * 
+     * @param running The process running on the CPU.
+     * @param cpuIndex The index of the CPU running the process.
+     * @param sliceStart The time at which the process starts making progress in this time slice.
+     * @param completionTime The time at which the process will complete if it is not interrupted.
+     */
+    void scheduleNextEvent(const Process& running, int cpuIndex, const int& sliceStart, const int& completionTime);
+
+    /**
+     * @brief Time quantum used by "RR", "AdaptiveRR" (until its first retune), "Stride", "Lottery" and "Group" when no `--quantum` option is given.
+     */
+    static constexpr int DEFAULT_RR_QUANTUM = 10;
+
+    /**
+     * @brief Without a `--horizon` option, periodic tasks are released until this many of the
+     *        longest period have passed after the last arrival in the input file.
+     */
+    static constexpr int DEFAULT_HORIZON_PERIODS = 10;
+
     int currentTime = 0;              /**< @brief The current simulation time. */
+    long long eventCount = 0;         /**< @brief Number of events processed so far. */
+    bool logDispatches = false;       /**< @brief Whether dispatches are recorded in `dispatches`. */
+    std::vector<Dispatch> dispatches; /**< @brief The recorded dispatches. */
+    Checkpoint* checkpoint = nullptr; /**< @brief The checkpoint to save during the run, if any. */
+    int checkpointTime = 0;           /**< @brief The time at which `checkpoint` is saved. */
     std::string algorithmType;       /**< @brief The type of scheduling algorithm used. */
     std::vector<Process> completedProcesses; /**< @brief A vector to store completed processes. */
-    CPU cpu;                          /**< @brief The CPU object for the simulation. */
+    std::vector<CPU> cpus;            /**< @brief The CPUs of the simulated machine. */
     ReadyQueue* readyQueue;           /**< @brief A pointer to the ready queue (algorithm-specific). */
-    EventQueue eventQueue;            /**< @brief The event queue for the simulation. */
+    BoundedReadyQueue* boundedQueue = nullptr; /**< @brief The ready queue if it applies admission control, otherwise null. */
+    int nextJobId = 1;                /**< @brief Process ID given to the next job released by a periodic task. */
+    long long shedWork = 0;           /**< @brief Work already done for processes that were shed. */
+    std::unique_ptr<MemoryManager> memory; /**< @brief Admits processes into limited memory, or null without a memory limit. */
+    std::unique_ptr<EventQueue> eventQueue; /**< @brief The event queue for the simulation (engine-specific). */
+    std::vector<IODevice> devices;    /**< @brief The simulated I/O devices. */
+    std::vector<int> phaseTable;      /**< @brief (I/O length, CPU burst length) pairs of every multi-phase process. */
+    std::vector<std::string> groupNames; /**< @brief Group path of every group ID. */
+    std::vector<EventKey> pendingEvents; /**< @brief Key of the completion or time-slice event of each CPU's running process. */
+    std::vector<Event> deferredEvents; /**< @brief Event of each CPU's running process not yet pushed in this time step. */
+    std::vector<bool> hasDeferredEvent; /**< @brief Whether each CPU's entry of `deferredEvents` is waiting to be pushed. */
+    std::vector<Process> readyBatch;  /**< @brief Processes waiting to join the ready queue in this time step, in order. */
+    int quantum = 0;                  /**< @brief Time slice length (0 runs processes to completion). */
+    std::unique_ptr<AdaptiveQuantum> adaptiveQuantum; /**< @brief Retunes `quantum` under "AdaptiveRR", otherwise null. */
+    bool preemptive = false;          /**< @brief Whether processes that become ready may preempt a running one. */
+    bool stepBatching = true;         /**< @brief Whether a time step's insertions are batched and its event pushes deferred. */
+    bool trackShares = false;         /**< @brief Whether the share lag of proportional-share algorithms is measured. */
+    double virtualTime = 0.0;         /**< @brief Virtual time of the ideal proportional-share schedule. */
+    int virtualTimeUpdated = 0;       /**< @brief The simulation time up to which `virtualTime` is computed. */
+    long long runnableTickets = 0;    /**< @brief Tickets held by processes that are ready or running. */
+    int releaseHorizon = 0;           /**< @brief Periodic tasks release no job at or after this time. */
+    bool reportSwitching = false;     /**< @brief Whether context-switch statistics are written to the output file. */
+    bool reportEnergy = false;        /**< @brief Whether per-CPU and energy statistics are written to the output file. */
+    std::string placement;            /**< @brief The placement policy choosing among idle CPUs. */
+    int bigBurstThreshold = 0;        /**< @brief Remaining burst from which the "size" placement prefers fast CPUs. */
+    std::string exportFile;           /**< @brief File receiving the per-process results (empty for none). */
+    std::string exportFormat;         /**< @brief Format of the export file ("columnar" or "csv"). */
 };
 
 #endif // SCHEDULER_H
@@ -0,0 +1,476 @@
+#include "Server.h"
+#include "Scheduler.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+    /**
+     * @brief Write end of the wake pipe of the running server, used by the signal handler.
+     */
+    int signalPipe = -1;
+
+    /**
+     * @brief Asks the running server to stop (SIGINT and SIGTERM).
+     */
+    void onSignal(int)
+    {
+        char stop = 's';
+        ssize_t written = write(signalPipe, &stop, 1);
+        (void)written;
+    }
+
+    /**
+     * @brief Writes all of `data` to a socket; a client that went away is ignored.
+     */
+    void sendAll(int fd, const std::string &data)
+    {
+        size_t sent = 0;
+        while (sent < data.size())
+        {
+            ssize_t written = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if (written < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (written <= 0)
+            {
+                return;
+            }
+            sent += written;
+        }
+    }
+
+    std::runtime_error systemError(const std::string &what)
+    {
+        return std::runtime_error(what + ": " + std::strerror(errno));
+    }
+}
+
+Server::Server(const std::string &socketPath, const Options &options)
+    : socketPath(socketPath), defaults(options), cacheSize(options.cacheSize)
+{
+    if (options.cacheSize < 1)
+    {
+        throw std::runtime_error("The workload cache needs room for at least one workload");
+    }
+}
+
+void Server::run()
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socketPath.empty() || socketPath.size() >= sizeof(address.sun_path))
+    {
+        throw std::runtime_error("Invalid socket path: " + socketPath);
+    }
+    std::strcpy(address.sun_path, socketPath.c_str());
+
+    // A socket left behind by a previous server is replaced; any other file is not.
+    if (std::filesystem::is_socket(socketPath))
+    {
+        std::filesystem::remove(socketPath);
+    }
+
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0)
+    {
+        throw systemError("Error creating socket");
+    }
+    if (bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0 || listen(listener, SOMAXCONN) < 0)
+    {
+        std::runtime_error error = systemError("Error listening on " + socketPath);
+        close(listener);
+        throw error;
+    }
+    if (pipe(wakePipe) < 0)
+    {
+        std::runtime_error error = systemError("Error creating pipe");
+        close(listener);
+        throw error;
+    }
+
+    signalPipe = wakePipe[1];
+    struct sigaction action{};
+    struct sigaction previousInterrupt, previousTerminate;
+    action.sa_handler = onSignal;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, &previousInterrupt);
+    sigaction(SIGTERM, &action, &previousTerminate);
+
+    std::unordered_map<int, Connection> connections;
+    {
+        ThreadPool pool(defaults.threads);
+        std::cout << "Listening on " << socketPath << " with " << pool.size() << " workers" << std::endl;
+
+        bool running = true;
+        while (running)
+        {
+            // Busy connections are not read until their request is answered, so requests stay in order.
+            std::vector<pollfd> polled = {{listener, POLLIN, 0}, {wakePipe[0], POLLIN, 0}};
+            for (const auto &entry : connections)
+            {
+                if (!entry.second.busy && !entry.second.closed)
+                {
+                    polled.push_back({entry.first, POLLIN, 0});
+                }
+            }
+            if (poll(polled.data(), polled.size(), -1) < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                throw systemError("Error polling connections");
+            }
+
+            if (polled[1].revents & POLLIN)
+            {
+                char bytes[64];
+                ssize_t count = read(wakePipe[0], bytes, sizeof(bytes));
+                if (count > 0 && std::find(bytes, bytes + count, 's') != bytes + count)
+                {
+                    running = false;
+                }
+
+                std::vector<int> answered;
+                {
+                    std::lock_guard<std::mutex> lock(doneMutex);
+                    answered.swap(done);
+                }
+                for (int fd : answered)
+                {
+                    connections.at(fd).busy = false;
+                }
+
+                std::lock_guard<std::mutex> lock(cacheMutex);
+                running = running && !stopping;
+            }
+
+            if (polled[0].revents & POLLIN)
+            {
+                int fd = accept(listener, nullptr, nullptr);
+                if (fd >= 0)
+                {
+                    connections.emplace(fd, Connection{fd});
+                }
+            }
+
+            for (size_t i = 2; i < polled.size(); i++)
+            {
+                if (polled[i].revents & (POLLIN | POLLHUP | POLLERR))
+                {
+                    Connection &connection = connections.at(polled[i].fd);
+                    char chunk[65536];
+                    ssize_t count = read(connection.fd, chunk, sizeof(chunk));
+                    if (count > 0 && connection.buffer.size() + count > MAX_BUFFERED_BYTES)
+                    {
+                        // An idle connection's buffer holds a single incomplete request, which is too
+                        // large to ever be answered; the client is told so and disconnected.
+                        sendAll(connection.fd, "ERROR Request exceeds " + std::to_string(MAX_BUFFERED_BYTES) + " bytes\n");
+                        connection.buffer.clear();
+                        connection.remainingLines = 0;
+                        connection.scanned = 0;
+                        connection.closed = true;
+                        std::lock_guard<std::mutex> lock(cacheMutex);
+                        requests++;
+                        errors++;
+                    }
+                    else if (count > 0)
+                    {
+                        connection.buffer.append(chunk, count);
+                    }
+                    else if (count == 0 || errno != EINTR)
+                    {
+                        // A last request without a newline is still answered.
+                        if (!connection.buffer.empty() && connection.buffer.back() != '\n')
+                        {
+                            connection.buffer += '\n';
+                        }
+                        connection.closed = true;
+                    }
+                }
+            }
+
+            // Start the next request of every idle connection, and forget the closed ones.
+            for (auto it = connections.begin(); it != connections.end();)
+            {
+                Connection &connection = it->second;
+                std::string request;
+                if (running && !connection.busy && takeRequest(connection, request))
+                {
+                    connection.busy = true;
+                    int fd = connection.fd;
+                    pool.submit([this, fd, request]
+                                {
+                                    sendAll(fd, handle(request) + "\n");
+                                    {
+                                        std::lock_guard<std::mutex> lock(doneMutex);
+                                        done.push_back(fd);
+                                    }
+                                    wake(); });
+                }
+
+                if (!connection.busy && connection.closed)
+                {
+                    close(connection.fd);
+                    it = connections.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+        // The pool finishes the requests already running before it is destroyed.
+    }
+
+    for (const auto &entry : connections)
+    {
+        close(entry.first);
+    }
+    close(listener);
+    std::filesystem::remove(socketPath);
+
+    sigaction(SIGINT, &previousInterrupt, nullptr);
+    sigaction(SIGTERM, &previousTerminate, nullptr);
+    signalPipe = -1;
+    close(wakePipe[0]);
+    close(wakePipe[1]);
+    wakePipe[0] = wakePipe[1] = -1;
+}
+
+bool Server::takeRequest(Connection &connection, std::string &request)
+{
+    std::string &buffer = connection.buffer;
+    if (connection.scanned == 0)
+    {
+        size_t end = buffer.find('\n');
+        if (end == std::string::npos)
+        {
+            return false;
+        }
+
+        std::istringstream words(buffer.substr(0, end));
+        std::string command, name;
+        long lines = 0;
+        if (!(words >> command >> name >> lines) || command != "WORKLOAD" || lines < 1 || lines > MAX_UPLOAD_LINES)
+        {
+            // Anything but a well-formed upload is a single line (a malformed upload is answered with an error).
+            request = buffer.substr(0, end);
+            buffer.erase(0, end + 1);
+            return true;
+        }
+        connection.remainingLines = lines;
+        connection.scanned = end + 1;
+    }
+
+    // An upload is complete once all of its lines have arrived; the lines seen so far are not scanned again.
+    while (connection.remainingLines > 0)
+    {
+        size_t end = buffer.find('\n', connection.scanned);
+        if (end == std::string::npos)
+        {
+            return false;
+        }
+        connection.scanned = end + 1;
+        connection.remainingLines--;
+    }
+
+    request = buffer.substr(0, connection.scanned);
+    buffer.erase(0, connection.scanned);
+    connection.scanned = 0;
+    return true;
+}
+
+std::string Server::handle(const std::string &request)
+{
+    size_t end = request.find('\n');
+    std::istringstream line(request.substr(0, end));
+    std::vector<std::string> words;
+    std::string word;
+    while (line >> word)
+    {
+        words.push_back(word);
+    }
+
+    std::string response;
+    bool failed = false;
+    try
+    {
+        if (words.empty())
+        {
+            throw std::runtime_error("Empty request");
+        }
+        else if (words[0] == "RUN")
+        {
+            response = runRequest(words);
+        }
+        else if (words[0] == "WORKLOAD")
+        {
+            response = uploadRequest(words, end == std::string::npos ? std::string() : request.substr(end + 1));
+        }
+        else if (words[0] == "STATS")
+        {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            response = "OK requests=" + std::to_string(requests) + " errors=" + std::to_string(errors) +
+                       " cache_hits=" + std::to_string(cacheHits) + " cache_misses=" + std::to_string(cacheMisses) +
+                       " cached_workloads=" + std::to_string(cache.size());
+        }
+        else if (words[0] == "SHUTDOWN")
+        {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            stopping = true;
+            response = "OK";
+        }
+        else
+        {
+            throw std::runtime_error("Unknown request: " + words[0]);
+        }
+    }
+    catch (const std::exception &error)
+    {
+        response = std::string("ERROR ") + error.what();
+        std::replace(response.begin(), response.end(), '\n', ' ');
+        failed = true;
+    }
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    requests++;
+    errors += failed;
+    return response;
+}
+
+std::string Server::runRequest(const std::vector<std::string> &words)
+{
+    if (words.size() < 3)
+    {
+        throw std::runtime_error("Usage: RUN <workload> <algorithm> [--option=value ...]");
+    }
+
+    Options options = defaults;
+    for (size_t i = 3; i < words.size(); i++)
+    {
+        options.apply(words[i]);
+    }
+    if (!options.tune.empty() || options.differential > 0 || options.nodes > 0 || !options.exportFile.empty() ||
+        options.inputFormat != "workload" || options.checkpoint || options.timing)
+    {
+        throw std::runtime_error("Tuning, differential testing, clusters, exports, trace input, checkpoints and timing "
+                                 "are not available in server mode");
+    }
+
+    std::shared_ptr<const Workload> workload = findWorkload(words[1]);
+    Scheduler scheduler(*workload, words[2], options);
+    scheduler.runSimulation();
+    Statistics statistics = scheduler.getStatistics();
+
+    std::ostringstream response;
+    response.precision(12);
+    response << "OK processes=" << statistics.processes
+             << " elapsed=" << statistics.elapsedTime
+             << " throughput=" << statistics.throughput
+             << " cpu_utilization=" << statistics.cpuUtilization
+             << " avg_waiting=" << statistics.avgWaitingTime
+             << " avg_turnaround=" << statistics.avgTurnaroundTime
+             << " avg_response=" << statistics.avgResponseTime
+             << " p99_response=" << statistics.p99ResponseTime
+             << " p99_turnaround=" << statistics.p99TurnaroundTime
+             << " context_switches=" << statistics.contextSwitches;
+    return response.str();
+}
+
+std::string Server::uploadRequest(const std::vector<std::string> &words, const std::string &lines)
+{
+    if (words.size() != 3 || lines.empty())
+    {
+        throw std::runtime_error("Usage: WORKLOAD <name> <lines>, followed by the header and process lines");
+    }
+
+    std::istringstream input(lines);
+    auto workload = std::make_shared<const Workload>(Workload::parse(input, 0));
+    size_t processes = workload->processes.size();
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    store(words[1], CacheEntry{workload, false, {}, {}});
+    return "OK workload=" + words[1] + " processes=" + std::to_string(processes);
+}
+
+std::shared_ptr<const Workload> Server::findWorkload(const std::string &name)
+{
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto found = cache.find(name);
+        if (found != cache.end() && !found->second.fromFile)
+        {
+            cacheHits++;
+            touch(found->second);
+            return found->second.workload;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::file_time_type modified = std::filesystem::last_write_time(name, error);
+    if (error)
+    {
+        throw std::runtime_error("Unknown workload: " + name);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto found = cache.find(name);
+        if (found != cache.end() && found->second.modified == modified)
+        {
+            cacheHits++;
+            touch(found->second);
+            return found->second.workload;
+        }
+    }
+
+    // The file is parsed without holding the lock, so that other requests are not held up.
+    auto workload = std::make_shared<const Workload>(Workload::load(name, 0));
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    cacheMisses++;
+    store(name, CacheEntry{workload, true, modified, {}});
+    return workload;
+}
+
+void Server::store(const std::string &name, CacheEntry entry)
+{
+    auto found = cache.find(name);
+    if (found != cache.end())
+    {
+        recency.erase(found->second.recent);
+    }
+    recency.push_front(name);
+    entry.recent = recency.begin();
+    cache[name] = std::move(entry);
+
+    while (cache.size() > cacheSize)
+    {
+        cache.erase(recency.back());
+        recency.pop_back();
+    }
+}
+
+void Server::touch(CacheEntry &entry)
+{
+    recency.splice(recency.begin(), recency, entry.recent);
+}
+
+void Server::wake() const
+{
+    char wakeUp = 'w';
+    ssize_t written = write(wakePipe[1], &wakeUp, 1);
+    (void)written;
+}
@@ -0,0 +1,168 @@
+/**
+ * @file Server.h
+ * @brief Defines the `Server` class answering simulation requests over a Unix domain socket.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef SERVER_H
+#define SERVER_H
+
+#include "Options.h"
+#include "Workload.h"
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class Server
+ * @brief A long-running simulator that answers requests on a Unix domain socket.
+ *
+ * Clients send newline-terminated text requests and receive one line per request:
+ *   - `RUN <workload> <algorithm> [--option=value ...]` simulates a workload and answers
+ *     `OK <name>=<value> ...` with the summary statistics. `<workload>` is the name of an
+ *     uploaded workload or the path of a data file.
+ *   - `WORKLOAD <name> <lines>` followed by `<lines>` lines (a header and the process lines
+ *     of a data file) uploads a workload under a name.
+ *   - `STATS` reports the request and cache counters.
+ *   - `SHUTDOWN` stops the server once the running requests have finished.
+ * Failed requests answer `ERROR <message>`.
+ *
+ * Parsed workloads are kept in a least-recently-used cache of `cacheSize` entries, and data
+ * files are parsed again only when their modification time changes. Requests run on a pool
+ * of `threads` workers; one thread multiplexes the connections with `poll`. Requests of one
+ * connection are answered in order, and requests of different connections run concurrently.
+ */
+class Server
+{
+public:
+    /**
+     * @brief Constructs a new `Server` object.
+     *
+     * @param socketPath The path of the Unix domain socket to listen on.
+     * @param options The default options of every request (`threads` and `cacheSize` configure the server).
+     * @throws std::runtime_error if the cache size is not positive.
+     */
+    Server(const std::string &socketPath, const Options &options);
+
+    Server(const Server &) = delete;
+    Server &operator=(const Server &) = delete;
+
+    /**
+     * @brief Listens for requests until a `SHUTDOWN` request, SIGINT, or SIGTERM.
+     *
+     * @throws std::runtime_error if the socket cannot be created.
+     */
+    void run();
+
+private:
+    /**
+     * @brief A client connection.
+     */
+    struct Connection
+    {
+        int fd;                  /**< @brief The connected socket. */
+        std::string buffer;      /**< @brief Received bytes not yet consumed by a request. */
+        bool busy = false;       /**< @brief Whether a request of this connection is being answered. */
+        bool closed = false;     /**< @brief Whether the client has closed its end. */
+        long remainingLines = 0; /**< @brief Upload lines still missing from the buffer. */
+        size_t scanned = 0;      /**< @brief End of the complete lines of an incomplete upload (0 if none). */
+    };
+
+    /**
+     * @brief A cached workload.
+     */
+    struct CacheEntry
+    {
+        std::shared_ptr<const Workload> workload; /**< @brief The parsed workload, shared by running requests. */
+        bool fromFile;                            /**< @brief Whether the workload was read from a data file. */
+        std::filesystem::file_time_type modified; /**< @brief The modification time of the file when it was read. */
+        std::list<std::string>::iterator recent;  /**< @brief The position of the entry in `recency`. */
+    };
+
+    /**
+     * @brief Takes the next complete request from a connection's buffer, if there is one.
+     *
+     * @param connection The connection.
+     * @param request Receives the request line and any upload lines.
+     * @return True if a complete request was taken.
+     */
+    static bool takeRequest(Connection &connection, std::string &request);
+
+    /**
+     * @brief Answers one request.
+     *
+     * @param request The request line, followed by the upload lines of a `WORKLOAD` request.
+     * @return The response line, without the newline.
+     */
+    std::string handle(const std::string &request);
+
+    /**
+     * @brief Simulates a workload for a `RUN` request.
+     */
+    std::string runRequest(const std::vector<std::string> &words);
+
+    /**
+     * @brief Stores an uploaded workload for a `WORKLOAD` request.
+     */
+    std::string uploadRequest(const std::vector<std::string> &words, const std::string &lines);
+
+    /**
+     * @brief Returns the cached workload of a name, reading the data file on a miss.
+     *
+     * @throws std::runtime_error if the name is neither an uploaded workload nor a readable data file.
+     */
+    std::shared_ptr<const Workload> findWorkload(const std::string &name);
+
+    /**
+     * @brief Adds or replaces a cache entry and evicts the least recently used entries beyond the capacity.
+     *
+     * Must be called with `cacheMutex` held.
+     */
+    void store(const std::string &name, CacheEntry entry);
+
+    /**
+     * @brief Marks a cache entry as the most recently used.
+     *
+     * Must be called with `cacheMutex` held.
+     */
+    void touch(CacheEntry &entry);
+
+    /**
+     * @brief Wakes the polling thread.
+     */
+    void wake() const;
+
+    /**
+     * @brief Maximum number of process lines in one uploaded workload.
+     */
+    static constexpr long MAX_UPLOAD_LINES = 10000000;
+
+    /**
+     * @brief Maximum number of bytes buffered for one connection's incomplete request.
+     */
+    static constexpr size_t MAX_BUFFERED_BYTES = size_t(256) << 20;
+
+    std::string socketPath;     /**< @brief The path of the listening socket. */
+    Options defaults;           /**< @brief The default options of every request. */
+    size_t cacheSize;           /**< @brief Maximum number of cached workloads. */
+    int wakePipe[2] = {-1, -1}; /**< @brief Written to by workers and signal handlers to wake the polling thread. */
+
+    std::mutex cacheMutex;                             /**< @brief Guards the cache and the counters. */
+    std::unordered_map<std::string, CacheEntry> cache; /**< @brief Cached workloads by name or file path. */
+    std::list<std::string> recency;                    /**< @brief Cached names, most recently used first. */
+    long long requests = 0;                            /**< @brief Requests answered. */
+    long long errors = 0;                              /**< @brief Requests answered with an error. */
+    long long cacheHits = 0;                           /**< @brief Workload lookups answered from the cache. */
+    long long cacheMisses = 0;                         /**< @brief Workload lookups that read a data file. */
+    bool stopping = false;                             /**< @brief Whether a `SHUTDOWN` request was received. */
+
+    std::mutex doneMutex;  /**< @brief Guards `done`. */
+    std::vector<int> done; /**< @brief Connections whose request has been answered, by descriptor. */
+};
+
+#endif // SERVER_H
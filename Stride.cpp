@@ -0,0 +1,33 @@
+#include "Stride.h"
+#include <algorithm>
+#include <stdexcept>
+
+void Stride::addProcess(const Process &p)
+{
+    Process queued = p;
+    queued.pass = std::max(queued.pass, globalPass);
+    readyQueue.push(queued);
+}
+
+Process Stride::getNextProcess()
+{
+    if (readyQueue.empty())
+    {
+        throw std::runtime_error("Error: Attempting to get a process from an empty Stride queue");
+    }
+
+    Process nextProcess = readyQueue.top();
+    readyQueue.pop();
+    globalPass = nextProcess.pass;
+    return nextProcess;
+}
+
+bool Stride::isEmpty() const
+{
+    return readyQueue.empty();
+}
+
+void Stride::chargeUsage(Process &p, int usedTime)
+{
+    p.pass += STRIDE1 / std::max(1, p.tickets) * usedTime;
+}
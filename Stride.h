@@ -0,0 +1,95 @@
+/**
+ * @file Stride.h
+ * @brief Defines the Stride proportional-share ready queue class for a CPU scheduling simulation.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef STRIDE_H
+#define STRIDE_H
+
+#include "ReadyQueue.h"
+#include <queue>
+#include <vector>
+
+/**
+ * @brief Ready queue implementation for stride scheduling, a deterministic proportional-share algorithm.
+ *
+ * Every process has a stride inversely proportional to its tickets and a pass value that
+ * advances by its stride for each unit of CPU time it uses. The process with the smallest
+ * pass runs next, so over time each process receives CPU time in proportion to its tickets.
+ *
+ * Processes are kept in a binary heap ordered by pass, so selection is O(log n). A process
+ * that (re)joins the queue starts at the current global pass, so time spent away from the
+ * queue cannot be saved up as credit.
+ */
+class Stride : public ReadyQueue
+{
+public:
+    /**
+     * @brief Adds a process to the stride ready queue.
+     *
+     * @param p The Process object to be added to the queue.
+     */
+    void addProcess(const Process &p) override;
+
+    /**
+     * @brief Retrieves and removes the process with the smallest pass.
+     *
+     * @return The Process object with the smallest pass.
+     * @throws std::runtime_error if the queue is empty.
+     */
+    Process getNextProcess() override;
+
+    /**
+     * @brief Checks if the stride ready queue is empty.
+     *
+     * @return True if the queue is empty, false otherwise.
+     */
+    bool isEmpty() const override;
+
+    /**
+     * @brief Advances the pass of a process by its stride for every unit of CPU time it used.
+     *
+     * @param p The process that left a CPU.
+     * @param usedTime The time the process spent on the CPU.
+     */
+    void chargeUsage(Process &p, int usedTime) override;
+
+    /**
+     * @brief The pass advance corresponding to one ticket's full stride.
+     */
+    static constexpr long long STRIDE1 = 1 << 20;
+
+private:
+    /**
+     * @brief Orders heap entries so that the smallest pass is on top (earliest arrival, then lowest process ID, breaks ties).
+     */
+    struct LaterPass
+    {
+        bool operator()(const Process &p1, const Process &p2) const
+        {
+            if (p1.pass == p2.pass)
+            {
+                if (p1.arrival_time == p2.arrival_time)
+                {
+                    return p1.process_id > p2.process_id; // Then the lower process ID, so that the order is total
+                }
+                return p1.arrival_time > p2.arrival_time; // Prioritize earlier arrival if passes are equal
+            }
+            return p1.pass > p2.pass; // Prioritize smaller pass
+        }
+    };
+
+    /**
+     * @brief The heap of ready processes ordered by pass.
+     */
+    std::priority_queue<Process, std::vector<Process>, LaterPass> readyQueue;
+
+    /**
+     * @brief The pass of the most recently selected process.
+     */
+    long long globalPass = 0;
+};
+
+#endif // STRIDE_H
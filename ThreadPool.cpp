@@ -0,0 +1,95 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+ThreadPool::ThreadPool(unsigned threads)
+{
+    if (threads == 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    workers.reserve(threads);
+    for (unsigned i = 0; i < threads; i++)
+    {
+        workers.emplace_back(&ThreadPool::work, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    available.notify_all();
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push(std::move(task));
+        pending++;
+    }
+    available.notify_one();
+}
+
+void ThreadPool::wait()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this]
+                  { return pending == 0; });
+    if (error)
+    {
+        std::exception_ptr thrown = error;
+        error = nullptr;
+        std::rethrow_exception(thrown);
+    }
+}
+
+size_t ThreadPool::size() const
+{
+    return workers.size();
+}
+
+void ThreadPool::work()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            available.wait(lock, [this]
+                           { return stopping || !tasks.empty(); });
+            if (tasks.empty())
+            {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop();
+        }
+
+        std::exception_ptr thrown;
+        try
+        {
+            task();
+        }
+        catch (...)
+        {
+            thrown = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (thrown && !error)
+        {
+            error = thrown;
+        }
+        if (--pending == 0)
+        {
+            finished.notify_all();
+        }
+    }
+}
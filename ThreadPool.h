@@ -0,0 +1,75 @@
+/**
+ * @file ThreadPool.h
+ * @brief Defines a fixed-size pool of worker threads.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief A fixed number of worker threads running submitted tasks in submission order.
+ */
+class ThreadPool
+{
+public:
+    /**
+     * @brief Starts the worker threads.
+     *
+     * @param threads The number of workers (0 uses one per hardware thread).
+     */
+    explicit ThreadPool(unsigned threads);
+
+    /**
+     * @brief Waits for the queued tasks and stops the workers.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * @brief Queues a task for the next free worker.
+     *
+     * @param task The task to run.
+     */
+    void submit(std::function<void()> task);
+
+    /**
+     * @brief Blocks until every submitted task has finished.
+     *
+     * @throws The first exception thrown by a task since the last call, if any.
+     */
+    void wait();
+
+    /**
+     * @brief Gets the number of worker threads.
+     */
+    size_t size() const;
+
+private:
+    /**
+     * @brief Runs queued tasks until the pool is stopped.
+     */
+    void work();
+
+    std::vector<std::thread> workers;        /**< @brief The worker threads. */
+    std::queue<std::function<void()>> tasks; /**< @brief Tasks waiting for a worker. */
+    std::mutex mutex;                        /**< @brief Guards every member below. */
+    std::condition_variable available;       /**< @brief Signaled when a task is queued or the pool stops. */
+    std::condition_variable finished;        /**< @brief Signaled when the last pending task finishes. */
+    size_t pending = 0;                      /**< @brief Tasks queued or running. */
+    bool stopping = false;                   /**< @brief Whether the workers should exit. */
+    std::exception_ptr error;                /**< @brief The first exception thrown by a task. */
+};
+
+#endif // THREADPOOL_H
@@ -0,0 +1,468 @@
+#include "TraceImporter.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Size of the read buffer of the trace file.
+     */
+    constexpr size_t READ_BUFFER_SIZE = 1 << 20;
+
+    enum class TraceEvent
+    {
+        NONE,
+        SWITCH,
+        WAKEUP,
+        EXIT
+    };
+
+    std::string_view trim(std::string_view text)
+    {
+        size_t first = text.find_first_not_of(' ');
+        if (first == std::string_view::npos)
+        {
+            return {};
+        }
+        size_t last = text.find_last_not_of(' ');
+        return text.substr(first, last - first + 1);
+    }
+}
+
+TraceImporter::TraceImporter(int microsecondsPerUnit) : microsecondsPerUnit(microsecondsPerUnit)
+{
+    if (microsecondsPerUnit < 1)
+    {
+        throw std::runtime_error("The trace time unit must be at least one microsecond");
+    }
+}
+
+void TraceImporter::convert(const std::string &traceFile, const std::string &workloadFile)
+{
+    std::vector<char> buffer(READ_BUFFER_SIZE);
+    std::ifstream input;
+    input.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+    input.open(traceFile);
+    if (!input.is_open())
+    {
+        throw std::runtime_error("Error opening file: " + traceFile);
+    }
+
+    // Jobs after the first time unit are streamed to a temporary file, because a task running
+    // when the trace starts may only be seen at its first switch, arriving before all of them.
+    std::string laterFile = workloadFile + ".tmp";
+    std::ofstream later(laterFile, std::ios::trunc);
+    if (!later.is_open())
+    {
+        throw std::runtime_error("Error opening output file: " + laterFile);
+    }
+
+    std::string line;
+    while (std::getline(input, line))
+    {
+        processLine(line);
+        writeJobs(later, false);
+    }
+
+    // Jobs still in progress when the trace ends are cut at its last event.
+    for (auto &entry : tasks)
+    {
+        Task &task = entry.second;
+        if (task.runStart >= 0)
+        {
+            task.burst += lastTime - task.runStart;
+            task.runStart = -1;
+        }
+        finishJob(entry.first, task);
+    }
+    tasks.clear();
+    writeJobs(later, true);
+    later.close();
+    if (!later)
+    {
+        throw std::runtime_error("Error writing output file: " + laterFile);
+    }
+
+    std::ofstream output(workloadFile, std::ios::trunc);
+    if (!output.is_open())
+    {
+        throw std::runtime_error("Error opening output file: " + workloadFile);
+    }
+    output << "Arrival time\tCPU Burst length\tPriority\n";
+    std::sort(initialJobs.begin(), initialJobs.end(), [](const Job &a, const Job &b)
+              { return a.pid != b.pid ? a.pid < b.pid : a.sequence < b.sequence; });
+    for (const Job &job : initialJobs)
+    {
+        output << job.arrival << ' ' << job.burst << ' ' << job.priority << '\n';
+    }
+    initialJobs.clear();
+    std::ifstream laterInput(laterFile);
+    if (laterInput.peek() != std::ifstream::traits_type::eof())
+    {
+        output << laterInput.rdbuf();
+    }
+    laterInput.close();
+    std::filesystem::remove(laterFile);
+
+    output.close();
+    if (!output)
+    {
+        throw std::runtime_error("Error writing output file: " + workloadFile);
+    }
+}
+
+void TraceImporter::processLine(std::string_view line)
+{
+    static const std::pair<std::string_view, TraceEvent> names[] = {
+        {"sched_switch:", TraceEvent::SWITCH},
+        {"sched_wakeup:", TraceEvent::WAKEUP},
+        {"sched_wakeup_new:", TraceEvent::WAKEUP},
+        {"sched_process_exit:", TraceEvent::EXIT}};
+
+    TraceEvent event = TraceEvent::NONE;
+    size_t position = line.find("sched_");
+    size_t nameLength = 0;
+    while (position != std::string_view::npos && event == TraceEvent::NONE)
+    {
+        if (position > 0 && (line[position - 1] == ' ' || line[position - 1] == ':'))
+        {
+            for (const auto &name : names)
+            {
+                if (line.compare(position, name.first.size(), name.first) == 0)
+                {
+                    event = name.second;
+                    nameLength = name.first.size();
+                    break;
+                }
+            }
+        }
+        if (event == TraceEvent::NONE)
+        {
+            position = line.find("sched_", position + 1);
+        }
+    }
+    if (event == TraceEvent::NONE)
+    {
+        return;
+    }
+
+    // The timestamp is the "seconds.fraction:" token before the event name ("sched:" is perf's prefix).
+    std::string_view head = line.substr(0, position);
+    if (head.size() >= 6 && head.substr(head.size() - 6) == "sched:")
+    {
+        head.remove_suffix(6);
+    }
+    head = trim(head);
+    if (head.empty() || head.back() != ':')
+    {
+        return;
+    }
+    head.remove_suffix(1);
+    size_t space = head.rfind(' ');
+    long long time = parseTimestamp(space == std::string_view::npos ? head : head.substr(space + 1));
+    if (time < 0)
+    {
+        return;
+    }
+
+    if (firstTime < 0)
+    {
+        firstTime = time;
+    }
+    lastTime = std::max(lastTime, time);
+    eventCount++;
+
+    std::string_view fields = line.substr(position + nameLength);
+    if (event == TraceEvent::SWITCH)
+    {
+        handleSwitch(fields, time);
+    }
+    else if (event == TraceEvent::WAKEUP)
+    {
+        handleWakeup(fields, time);
+    }
+    else
+    {
+        handleExit(fields, time);
+    }
+}
+
+void TraceImporter::handleSwitch(std::string_view fields, long long time)
+{
+    int prevPid, prevPrio, nextPid, nextPrio;
+    std::string_view prevState;
+
+    if (!fieldValue(fields, "prev_pid").empty())
+    {
+        prevPid = static_cast<int>(parseNumber(fieldValue(fields, "prev_pid")));
+        prevPrio = static_cast<int>(parseNumber(fieldValue(fields, "prev_prio")));
+        prevState = fieldValue(fields, "prev_state");
+        nextPid = static_cast<int>(parseNumber(fieldValue(fields, "next_pid")));
+        nextPrio = static_cast<int>(parseNumber(fieldValue(fields, "next_prio")));
+    }
+    else
+    {
+        size_t arrow = fields.find(" ==> ");
+        if (arrow == std::string_view::npos)
+        {
+            return;
+        }
+        prevState = trim(parseTaskReference(fields.substr(0, arrow), prevPid, prevPrio));
+        parseTaskReference(fields.substr(arrow + 5), nextPid, nextPrio);
+    }
+
+    if (prevPid != 0)
+    {
+        auto found = tasks.find(prevPid);
+        if (found == tasks.end())
+        {
+            // First seen running: it has been running since the trace started.
+            found = tasks.emplace(prevPid, Task()).first;
+            startJob(found->second, firstTime);
+            found->second.runStart = firstTime;
+        }
+
+        Task &task = found->second;
+        task.prio = prevPrio;
+        if (task.runStart >= 0)
+        {
+            task.burst += time - task.runStart;
+            task.runStart = -1;
+        }
+        if (prevState.empty() || prevState[0] != 'R')
+        {
+            finishJob(prevPid, task);
+            if (!prevState.empty() && (prevState[0] == 'X' || prevState[0] == 'Z'))
+            {
+                tasks.erase(found);
+            }
+        }
+    }
+
+    if (nextPid != 0)
+    {
+        Task &task = tasks[nextPid];
+        task.prio = nextPrio;
+        if (task.arrival < 0)
+        {
+            startJob(task, time);
+        }
+        task.runStart = time;
+    }
+}
+
+void TraceImporter::handleWakeup(std::string_view fields, long long time)
+{
+    int pid, prio;
+    if (!fieldValue(fields, "pid").empty())
+    {
+        pid = static_cast<int>(parseNumber(fieldValue(fields, "pid")));
+        prio = static_cast<int>(parseNumber(fieldValue(fields, "prio")));
+    }
+    else
+    {
+        parseTaskReference(fields, pid, prio);
+    }
+    if (pid == 0)
+    {
+        return;
+    }
+
+    Task &task = tasks[pid];
+    task.prio = prio;
+    if (task.arrival < 0)
+    {
+        startJob(task, time);
+    }
+}
+
+void TraceImporter::handleExit(std::string_view fields, long long time)
+{
+    // A running task is switched out (in state X or Z) right after this event, which ends its job
+    // and forgets it; anything else is forgotten now, so that a later task reusing the PID starts afresh.
+    int pid = static_cast<int>(parseNumber(fieldValue(fields, "pid")));
+    auto found = tasks.find(pid);
+    if (found != tasks.end() && found->second.runStart < 0)
+    {
+        finishJob(pid, found->second);
+        tasks.erase(found);
+    }
+}
+
+void TraceImporter::startJob(Task &task, long long time)
+{
+    task.arrival = time;
+    if (time - firstTime >= microsecondsPerUnit)
+    {
+        openArrivals.insert(time);
+    }
+}
+
+void TraceImporter::finishJob(int pid, Task &task)
+{
+    if (task.arrival >= 0 && task.arrival - firstTime >= microsecondsPerUnit)
+    {
+        openArrivals.erase(openArrivals.find(task.arrival));
+    }
+    if (task.arrival >= 0 && task.burst > 0)
+    {
+        Job job;
+        job.arrival = toUnits(task.arrival - firstTime);
+        job.pid = pid;
+        job.burst = std::max(1, static_cast<int>(std::llround(static_cast<double>(task.burst) / microsecondsPerUnit)));
+        job.priority = std::max(1, task.prio - 99);
+        job.sequence = jobCount;
+        if (job.arrival == 0)
+        {
+            initialJobs.push_back(job);
+        }
+        else
+        {
+            jobs.push(job);
+        }
+        jobCount++;
+    }
+    task.arrival = -1;
+    task.burst = 0;
+}
+
+void TraceImporter::writeJobs(std::ostream &output, bool all)
+{
+    if (jobs.empty())
+    {
+        return;
+    }
+
+    // Jobs yet to start arrive at the latest event or later, and jobs in progress at their
+    // recorded arrival; a buffered job in an earlier time unit can no longer be overtaken.
+    int bound = INT_MAX;
+    if (!all)
+    {
+        long long earliest = openArrivals.empty() ? lastTime : std::min(*openArrivals.begin(), lastTime);
+        bound = toUnits(earliest - firstTime);
+    }
+    while (!jobs.empty() && (all || jobs.top().arrival < bound))
+    {
+        const Job &job = jobs.top();
+        output << job.arrival << ' ' << job.burst << ' ' << job.priority << '\n';
+        jobs.pop();
+    }
+}
+
+int TraceImporter::toUnits(long long microseconds) const
+{
+    long long units = microseconds / microsecondsPerUnit;
+    if (units > INT_MAX)
+    {
+        throw std::runtime_error("The trace is too long for the time unit; use a larger --trace-unit");
+    }
+    return static_cast<int>(units);
+}
+
+long long TraceImporter::parseTimestamp(std::string_view text)
+{
+    size_t dot = text.find('.');
+    if (dot == std::string_view::npos || dot == 0)
+    {
+        return -1;
+    }
+
+    long long seconds = 0;
+    for (char c : text.substr(0, dot))
+    {
+        if (c < '0' || c > '9')
+        {
+            return -1;
+        }
+        seconds = seconds * 10 + (c - '0');
+    }
+
+    // Fractions have 6 (ftrace, microseconds) or 9 (perf, nanoseconds) digits.
+    long long micros = 0;
+    int digits = 0;
+    for (char c : text.substr(dot + 1))
+    {
+        if (c < '0' || c > '9')
+        {
+            return -1;
+        }
+        if (digits < 6)
+        {
+            micros = micros * 10 + (c - '0');
+            digits++;
+        }
+    }
+    for (; digits < 6; digits++)
+    {
+        micros *= 10;
+    }
+    return seconds * 1000000 + micros;
+}
+
+std::string_view TraceImporter::fieldValue(std::string_view fields, std::string_view key)
+{
+    size_t position = 0;
+    while ((position = fields.find(key, position)) != std::string_view::npos)
+    {
+        size_t end = position + key.size();
+        if ((position == 0 || fields[position - 1] == ' ') && end < fields.size() && fields[end] == '=')
+        {
+            std::string_view value = fields.substr(end + 1);
+            return value.substr(0, value.find(' '));
+        }
+        position = end;
+    }
+    return {};
+}
+
+std::string_view TraceImporter::parseTaskReference(std::string_view text, int &pid, int &prio)
+{
+    pid = 0;
+    prio = 120;
+    size_t open = text.rfind('[');
+    if (open == std::string_view::npos)
+    {
+        return {};
+    }
+
+    std::string_view name = trim(text.substr(0, open));
+    size_t colon = name.rfind(':');
+    if (colon != std::string_view::npos)
+    {
+        pid = static_cast<int>(parseNumber(name.substr(colon + 1)));
+    }
+    prio = static_cast<int>(parseNumber(text.substr(open + 1)));
+
+    size_t close = text.find(']', open);
+    return close == std::string_view::npos ? std::string_view() : text.substr(close + 1);
+}
+
+long long TraceImporter::parseNumber(std::string_view text)
+{
+    size_t i = 0;
+    while (i < text.size() && text[i] == ' ')
+    {
+        i++;
+    }
+    long long value = 0;
+    for (; i < text.size() && text[i] >= '0' && text[i] <= '9'; i++)
+    {
+        value = value * 10 + (text[i] - '0');
+    }
+    return value;
+}
+
+long long TraceImporter::getEventCount() const
+{
+    return eventCount;
+}
+
+long long TraceImporter::getJobCount() const
+{
+    return jobCount;
+}
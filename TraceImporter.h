@@ -0,0 +1,192 @@
+/**
+ * @file TraceImporter.h
+ * @brief Defines the `TraceImporter` class converting Linux scheduler traces into workload files.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef TRACEIMPORTER_H
+#define TRACEIMPORTER_H
+
+#include <ostream>
+#include <queue>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class TraceImporter
+ * @brief Reconstructs per-task jobs from `perf sched script` or ftrace text dumps.
+ *
+ * Only `sched_switch`, `sched_wakeup`, `sched_wakeup_new` and `sched_process_exit` events are used;
+ * both the ftrace `key=value` layout and the `comm:pid [prio]` layout of `perf sched script`
+ * are recognized, and every other line is skipped.
+ *
+ * A job starts when a task is woken (or first seen running) and ends when the task is switched
+ * out in a state other than runnable (`R`/`R+`), i.e. when it blocks or exits. Its CPU burst is
+ * the time the task ran in between, across preemptions. Each job becomes one workload line:
+ * arrival and burst are converted to simulator time units, and the kernel priority becomes the
+ * simulator priority `prio - 99` (nice -20..19 maps to 1..40; real-time tasks map to 1).
+ *
+ * The trace is read in a single pass, its events being in time order as perf and ftrace write
+ * them. Jobs end in a different order than they arrive, so ended jobs wait in a reorder buffer
+ * (a min-heap on arrival, then PID) and are written as soon as no job still in progress or yet
+ * to start can arrive before them. The converted file lists jobs in the order they arrive, like
+ * any other workload file, and memory depends on the number of tasks with a job in progress,
+ * not on the length of the trace. Only the jobs arriving in the first time unit, which include
+ * those of the tasks running when the trace starts, are kept until the end and written first.
+ */
+class TraceImporter
+{
+public:
+    /**
+     * @brief Constructs a new `TraceImporter` object.
+     *
+     * @param microsecondsPerUnit The length of one simulator time unit in microseconds.
+     * @throws std::runtime_error if the time unit is not positive.
+     */
+    explicit TraceImporter(int microsecondsPerUnit);
+
+    /**
+     * @brief Converts a trace into a workload file readable by `Workload::load`.
+     *
+     * @param traceFile The `perf sched script` or ftrace text dump.
+     * @param workloadFile The workload file to write.
+     * @throws std::runtime_error if a file cannot be opened or a time does not fit the time unit.
+     */
+    void convert(const std::string &traceFile, const std::string &workloadFile);
+
+    /**
+     * @brief Gets the number of scheduler events used.
+     */
+    long long getEventCount() const;
+
+    /**
+     * @brief Gets the number of jobs written.
+     */
+    long long getJobCount() const;
+
+private:
+    /**
+     * @brief The state of a traced task.
+     */
+    struct Task
+    {
+        long long arrival = -1;  /**< @brief Start of the current job in microseconds (-1 when blocked). */
+        long long burst = 0;     /**< @brief CPU time of the current job so far, in microseconds. */
+        long long runStart = -1; /**< @brief Time the task was switched in (-1 when not running). */
+        int prio = 120;          /**< @brief Kernel priority (120 is nice 0). */
+    };
+
+    /**
+     * @brief A job reconstructed from the trace, in simulator time units.
+     */
+    struct Job
+    {
+        int arrival;  /**< @brief Arrival time. */
+        int pid;      /**< @brief PID of the task, which orders jobs arriving together. */
+        int burst;    /**< @brief CPU burst length. */
+        int priority; /**< @brief Simulator priority. */
+        long long sequence; /**< @brief Number of jobs ended before it, which orders the jobs of a PID arriving together. */
+    };
+
+    /**
+     * @brief Orders the reorder buffer so that the earliest arrival (then the lowest PID) is on top.
+     */
+    struct LaterJob
+    {
+        bool operator()(const Job &a, const Job &b) const
+        {
+            if (a.arrival != b.arrival)
+            {
+                return a.arrival > b.arrival;
+            }
+            return a.pid != b.pid ? a.pid > b.pid : a.sequence > b.sequence;
+        }
+    };
+
+    /**
+     * @brief Dispatches one trace line to the handler of its event.
+     */
+    void processLine(std::string_view line);
+
+    /**
+     * @brief Handles a task being switched out and another being switched in on a CPU.
+     */
+    void handleSwitch(std::string_view fields, long long time);
+
+    /**
+     * @brief Handles a task becoming runnable.
+     */
+    void handleWakeup(std::string_view fields, long long time);
+
+    /**
+     * @brief Handles a task exiting.
+     */
+    void handleExit(std::string_view fields, long long time);
+
+    /**
+     * @brief Starts a job of a task arriving at a given time.
+     */
+    void startJob(Task &task, long long time);
+
+    /**
+     * @brief Ends the current job of a task and adds it to the reorder buffer (or to `initialJobs`).
+     *
+     * @param pid The PID of the task.
+     * @param task The state of the task.
+     */
+    void finishJob(int pid, Task &task);
+
+    /**
+     * @brief Writes the buffered jobs that no later job can arrive before.
+     *
+     * @param output The file receiving the jobs after the first time unit.
+     * @param all Whether to write every buffered job, at the end of the trace.
+     */
+    void writeJobs(std::ostream &output, bool all);
+
+    /**
+     * @brief Converts a duration in microseconds to simulator time units.
+     */
+    int toUnits(long long microseconds) const;
+
+    /**
+     * @brief Parses a `seconds.fraction` timestamp into microseconds.
+     */
+    static long long parseTimestamp(std::string_view text);
+
+    /**
+     * @brief Finds the value of a `key=value` field (empty if absent).
+     */
+    static std::string_view fieldValue(std::string_view fields, std::string_view key);
+
+    /**
+     * @brief Parses a `comm:pid [prio]` task reference of the `perf sched script` layout.
+     *
+     * @param text The text starting with the task reference.
+     * @param pid Receives the process ID.
+     * @param prio Receives the priority.
+     * @return The text after the reference.
+     */
+    static std::string_view parseTaskReference(std::string_view text, int &pid, int &prio);
+
+    /**
+     * @brief Parses a leading decimal integer, ignoring leading spaces (0 if there is none).
+     */
+    static long long parseNumber(std::string_view text);
+
+    int microsecondsPerUnit;                  /**< @brief Length of one simulator time unit. */
+    std::unordered_map<int, Task> tasks;      /**< @brief State of every task seen, by PID. */
+    std::multiset<long long> openArrivals;    /**< @brief Arrival, in microseconds, of every job in progress after the first time unit. */
+    std::vector<Job> initialJobs;             /**< @brief Ended jobs arriving in the first time unit. */
+    std::priority_queue<Job, std::vector<Job>, LaterJob> jobs; /**< @brief Ended jobs not yet written, earliest arrival on top. */
+    long long firstTime = -1;                 /**< @brief Timestamp of the first event, the simulation's time 0. */
+    long long lastTime = 0;                   /**< @brief Timestamp of the latest event. */
+    long long eventCount = 0;                 /**< @brief Scheduler events used. */
+    long long jobCount = 0;                   /**< @brief Jobs written. */
+};
+
+#endif // TRACEIMPORTER_H
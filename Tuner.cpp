@@ -0,0 +1,340 @@
+#include "Tuner.h"
+#include "Scheduler.h"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+    /**
+     * @brief The "halving" strategy stops halving once this many candidates would be left.
+     */
+    constexpr int MIN_HALVING_SURVIVORS = 4;
+
+    /**
+     * @brief Number of values searched for a parameter given without a step.
+     */
+    constexpr int DEFAULT_STEPS = 10;
+}
+
+Tuner::Tuner(Workload workload, const std::string &algorithmType, const Options &options)
+    : workload(std::move(workload)), algorithmType(algorithmType), options(options),
+      space(parseSpace(options.tuneSpace)), pool(static_cast<unsigned>(std::max(0, options.threads))),
+      random(options.seed)
+{
+    if (options.tune != "grid" && options.tune != "random" && options.tune != "halving")
+    {
+        throw std::runtime_error("Invalid tuning strategy: " + options.tune);
+    }
+    objective(Statistics());
+    if (options.tuneSamples < 1)
+    {
+        throw std::runtime_error("At least one tuning sample is required");
+    }
+
+    // Reject unknown options and malformed values before any simulation runs.
+    Options check = options;
+    for (const Parameter &parameter : space)
+    {
+        check.set(parameter.name, formatValue(parameter.low));
+        check.set(parameter.name, formatValue(parameter.high));
+    }
+}
+
+std::vector<Tuner::Parameter> Tuner::parseSpace(const std::string &list)
+{
+    std::vector<Parameter> parameters;
+    std::stringstream entries(list);
+    std::string entry;
+
+    while (std::getline(entries, entry, ','))
+    {
+        std::stringstream fields(entry);
+        std::string field;
+        std::vector<std::string> parts;
+        while (std::getline(fields, field, ':'))
+        {
+            parts.push_back(field);
+        }
+
+        Parameter parameter;
+        try
+        {
+            if (parts.size() != 3 && parts.size() != 4)
+            {
+                throw std::invalid_argument(entry);
+            }
+            parameter.name = parts[0];
+            parameter.low = std::stod(parts[1]);
+            parameter.high = std::stod(parts[2]);
+            if (parts.size() == 4)
+            {
+                parameter.step = std::stod(parts[3]);
+            }
+            else
+            {
+                parameter.step = (parameter.high - parameter.low) / (DEFAULT_STEPS - 1);
+                if (parameter.low == std::floor(parameter.low) && parameter.high == std::floor(parameter.high))
+                {
+                    parameter.step = std::max(1.0, std::round(parameter.step));
+                }
+            }
+            if (parameter.high < parameter.low || (parameter.step <= 0.0 && parameter.high > parameter.low))
+            {
+                throw std::invalid_argument(entry);
+            }
+        }
+        catch (const std::exception &)
+        {
+            throw std::runtime_error("Invalid tuning parameter (expected name:low:high[:step]): " + entry);
+        }
+        parameters.push_back(parameter);
+    }
+
+    if (parameters.empty())
+    {
+        throw std::runtime_error("The tuner needs at least one parameter (--tune-space)");
+    }
+    return parameters;
+}
+
+void Tuner::run()
+{
+    auto started = std::chrono::steady_clock::now();
+    size_t total = workload.processes.size();
+    if (options.maxProcesses > 0)
+    {
+        total = std::min(total, static_cast<size_t>(options.maxProcesses));
+    }
+
+    if (options.tune == "grid")
+    {
+        results = gridCandidates();
+        evaluate(results, total);
+    }
+    else if (options.tune == "random")
+    {
+        results = randomCandidates(options.tuneSamples);
+        evaluate(results, total);
+    }
+    else
+    {
+        std::vector<Candidate> survivors = randomCandidates(options.tuneSamples);
+        int rounds = 0;
+        while ((static_cast<int>(survivors.size()) >> (rounds + 1)) >= MIN_HALVING_SURVIVORS)
+        {
+            rounds++;
+        }
+
+        for (int round = rounds; round > 0; round--)
+        {
+            size_t prefix = std::max<size_t>(1, total >> round);
+            evaluate(survivors, prefix);
+            std::stable_sort(survivors.begin(), survivors.end(), [this](const Candidate &a, const Candidate &b)
+                             { return objective(a.statistics) < objective(b.statistics); });
+            survivors.resize((survivors.size() + 1) / 2);
+        }
+        evaluate(survivors, total);
+        results = std::move(survivors);
+    }
+
+    wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+}
+
+std::vector<Tuner::Candidate> Tuner::gridCandidates() const
+{
+    std::vector<Candidate> candidates(1);
+    for (const Parameter &parameter : space)
+    {
+        std::vector<Candidate> extended;
+        for (const Candidate &partial : candidates)
+        {
+            for (int i = 0; parameter.low + i * parameter.step <= parameter.high + 1e-9; i++)
+            {
+                Candidate candidate = partial;
+                candidate.values.push_back(parameter.low + i * parameter.step);
+                extended.push_back(candidate);
+                if (parameter.step <= 0.0)
+                {
+                    break;
+                }
+            }
+        }
+        candidates = std::move(extended);
+    }
+    return candidates;
+}
+
+std::vector<Tuner::Candidate> Tuner::randomCandidates(int count)
+{
+    std::vector<Candidate> candidates;
+    std::set<std::vector<double>> seen;
+
+    for (int attempt = 0; attempt < count * 100 && static_cast<int>(candidates.size()) < count; attempt++)
+    {
+        Candidate candidate;
+        for (const Parameter &parameter : space)
+        {
+            int steps = parameter.step > 0.0 ? static_cast<int>(std::floor((parameter.high - parameter.low) / parameter.step + 1e-9)) : 0;
+            std::uniform_int_distribution<int> pick(0, steps);
+            candidate.values.push_back(parameter.low + pick(random) * parameter.step);
+        }
+        if (seen.insert(candidate.values).second)
+        {
+            candidates.push_back(candidate);
+        }
+    }
+    return candidates;
+}
+
+void Tuner::evaluate(std::vector<Candidate> &candidates, size_t processCount)
+{
+    for (Candidate &candidate : candidates)
+    {
+        Options candidateOptions = options;
+        candidateOptions.exportFile.clear();
+        candidateOptions.maxProcesses = static_cast<int>(processCount);
+        for (size_t i = 0; i < space.size(); i++)
+        {
+            candidateOptions.set(space[i].name, formatValue(candidate.values[i]));
+        }
+
+        Candidate *target = &candidate;
+        pool.submit([this, target, candidateOptions]
+                    {
+                        Scheduler scheduler(workload, algorithmType, candidateOptions);
+                        scheduler.runSimulation();
+                        target->statistics = scheduler.getStatistics(); });
+    }
+    pool.wait();
+    evaluations += candidates.size();
+}
+
+double Tuner::objective(const Statistics &statistics) const
+{
+    const std::string &metric = options.tuneMetric;
+    if (metric == "avg-waiting")
+    {
+        return statistics.avgWaitingTime;
+    }
+    if (metric == "avg-turnaround")
+    {
+        return statistics.avgTurnaroundTime;
+    }
+    if (metric == "avg-response")
+    {
+        return statistics.avgResponseTime;
+    }
+    if (metric == "p99-response")
+    {
+        return statistics.p99ResponseTime;
+    }
+    if (metric == "p99-turnaround")
+    {
+        return statistics.p99TurnaroundTime;
+    }
+    if (metric == "throughput")
+    {
+        return -statistics.throughput;
+    }
+    throw std::runtime_error("Invalid tuning metric: " + metric);
+}
+
+bool Tuner::dominates(const Statistics &a, const Statistics &b)
+{
+    bool noWorse = a.avgTurnaroundTime <= b.avgTurnaroundTime && a.p99ResponseTime <= b.p99ResponseTime &&
+                   a.throughput >= b.throughput;
+    bool better = a.avgTurnaroundTime < b.avgTurnaroundTime || a.p99ResponseTime < b.p99ResponseTime ||
+                  a.throughput > b.throughput;
+    return noWorse && better;
+}
+
+std::string Tuner::formatValue(double value)
+{
+    // Whole values are written as integers so that integer options accept them at any magnitude.
+    if (value == std::round(value) && std::fabs(value) < 1e18)
+    {
+        return std::to_string(static_cast<long long>(value));
+    }
+    // Other values are written with the fewest digits that parse back to the same double.
+    char formatted[32];
+    std::to_chars_result result = std::to_chars(formatted, formatted + sizeof(formatted), value);
+    return std::string(formatted, result.ptr);
+}
+
+void Tuner::printResults(const std::string &input_filename) const
+{
+    std::string filename = std::filesystem::path(input_filename).stem().string();
+    std::string outputFileName = filename + "-" + algorithmType + "-tuning-output.txt";
+    std::ofstream outputFile(outputFileName, std::ios::trunc);
+
+    if (!outputFile.is_open())
+    {
+        throw std::runtime_error("Error opening output file: " + outputFileName);
+    }
+
+    std::string header;
+    for (const Parameter &parameter : space)
+    {
+        header += parameter.name + " ";
+    }
+    header += "processes avg_waiting avg_turnaround avg_response p99_response p99_turnaround throughput switches\n";
+
+    auto printCandidate = [&](const Candidate &candidate)
+    {
+        for (double value : candidate.values)
+        {
+            outputFile << formatValue(value) << " ";
+        }
+        const Statistics &s = candidate.statistics;
+        outputFile << s.processes << " " << s.avgWaitingTime << " " << s.avgTurnaroundTime << " " << s.avgResponseTime << " "
+                   << s.p99ResponseTime << " " << s.p99TurnaroundTime << " " << s.throughput << " " << s.contextSwitches << "\n";
+    };
+
+    outputFile << "\n----------------- Tuning -----------------\n";
+    outputFile << "Strategy: " << options.tune << std::endl;
+    outputFile << "Metric: " << options.tuneMetric << std::endl;
+    outputFile << "Simulations: " << evaluations << " (" << results.size() << " on the whole workload)" << std::endl;
+
+    if (!results.empty())
+    {
+        const Candidate &best = *std::min_element(results.begin(), results.end(), [this](const Candidate &a, const Candidate &b)
+                                                  { return objective(a.statistics) < objective(b.statistics); });
+        outputFile << "Best:";
+        for (size_t i = 0; i < space.size(); i++)
+        {
+            outputFile << " " << space[i].name << "=" << formatValue(best.values[i]);
+        }
+        outputFile << std::endl;
+
+        outputFile << "Pareto front (avg turnaround, p99 response, throughput):\n"
+                   << header;
+        for (const Candidate &candidate : results)
+        {
+            bool dominated = std::any_of(results.begin(), results.end(), [&](const Candidate &other)
+                                         { return dominates(other.statistics, candidate.statistics); });
+            if (!dominated)
+            {
+                printCandidate(candidate);
+            }
+        }
+
+        outputFile << "All candidates:\n"
+                   << header;
+        for (const Candidate &candidate : results)
+        {
+            printCandidate(candidate);
+        }
+    }
+    outputFile << "---------------------------------------------\n";
+
+    std::cout << "Tuned " << evaluations << " simulations on " << pool.size() << " threads in " << wallTime << " s" << std::endl;
+    std::cout << "Tuning results output to " << outputFileName << std::endl;
+}
@@ -0,0 +1,132 @@
+/**
+ * @file Tuner.h
+ * @brief Defines the `Tuner` class searching scheduler parameters for one workload and metric.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef TUNER_H
+#define TUNER_H
+
+#include "Metrics.h"
+#include "Options.h"
+#include "ThreadPool.h"
+#include "Workload.h"
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @class Tuner
+ * @brief Searches numeric simulator options for the values that optimize one metric.
+ *
+ * Every candidate is a set of values for the searched options and is evaluated by a full
+ * `Scheduler` run. Candidates run concurrently on a thread pool, and all of them read the
+ * same parsed workload. Supported strategies:
+ *   - "grid": every combination of the parameter steps.
+ *   - "random": `tuneSamples` distinct random combinations of steps.
+ *   - "halving": successive halving. `tuneSamples` random candidates are first evaluated on a
+ *     prefix of the workload; the better half is kept and the prefix doubled each round,
+ *     until the survivors (at least four, when there are that many) run the whole workload.
+ *
+ * Besides the best candidate for the target metric, the tuner reports the Pareto front of the
+ * fully evaluated candidates over average turnaround, p99 response time, and throughput.
+ */
+class Tuner
+{
+public:
+    /**
+     * @brief Constructs a new `Tuner` object.
+     *
+     * @param workload The workload every candidate simulates.
+     * @param algorithmType The scheduling algorithm to tune.
+     * @param options The base options of every candidate (`tune`, `tuneSpace`, `tuneMetric`,
+     *                `tuneSamples`, `threads`, and `seed` configure the search).
+     * @throws std::runtime_error if the strategy, metric, or parameter space is invalid.
+     */
+    Tuner(Workload workload, const std::string &algorithmType, const Options &options);
+
+    /**
+     * @brief Evaluates the candidates chosen by the search strategy.
+     */
+    void run();
+
+    /**
+     * @brief Writes every fully evaluated candidate, the best one, and the Pareto front to
+     *        `<data_file_stem>-<algorithm>-tuning-output.txt`.
+     *
+     * @param input_filename The name of the input file used for the search.
+     * @throws std::runtime_error if the output file cannot be opened.
+     */
+    void printResults(const std::string &input_filename) const;
+
+private:
+    /**
+     * @brief A searched option and its range.
+     */
+    struct Parameter
+    {
+        std::string name; /**< @brief The option name (without dashes). */
+        double low;       /**< @brief The smallest value. */
+        double high;      /**< @brief The largest value. */
+        double step;      /**< @brief The distance between searched values. */
+    };
+
+    /**
+     * @brief A combination of parameter values and its measured metrics.
+     */
+    struct Candidate
+    {
+        std::vector<double> values; /**< @brief One value per parameter. */
+        Statistics statistics;      /**< @brief The metrics of the last evaluation. */
+    };
+
+    /**
+     * @brief Parses the `name:low:high[:step]` entries of the parameter space.
+     *
+     * Without a step, ten values are searched (integral steps when both bounds are integers).
+     */
+    static std::vector<Parameter> parseSpace(const std::string &space);
+
+    /**
+     * @brief Builds every combination of parameter steps.
+     */
+    std::vector<Candidate> gridCandidates() const;
+
+    /**
+     * @brief Draws up to `count` distinct random combinations of parameter steps.
+     */
+    std::vector<Candidate> randomCandidates(int count);
+
+    /**
+     * @brief Simulates every candidate concurrently on the first `processCount` processes of the workload.
+     */
+    void evaluate(std::vector<Candidate> &candidates, size_t processCount);
+
+    /**
+     * @brief Gets the value of the target metric, oriented so that smaller is better.
+     */
+    double objective(const Statistics &statistics) const;
+
+    /**
+     * @brief Checks whether `a` is at least as good as `b` on every Pareto objective and better on one.
+     */
+    static bool dominates(const Statistics &a, const Statistics &b);
+
+    /**
+     * @brief Formats a parameter value as an option value.
+     */
+    static std::string formatValue(double value);
+
+    Workload workload;                  /**< @brief The workload shared by all candidates. */
+    std::string algorithmType;          /**< @brief The tuned scheduling algorithm. */
+    Options options;                    /**< @brief The base options of every candidate. */
+    std::vector<Parameter> space;       /**< @brief The searched parameters. */
+    ThreadPool pool;                    /**< @brief The workers evaluating candidates. */
+    std::mt19937_64 random;             /**< @brief Random source of the "random" and "halving" strategies. */
+    std::vector<Candidate> results;     /**< @brief The candidates evaluated on the whole workload. */
+    int evaluations = 0;                /**< @brief Number of simulations run, including partial ones. */
+    double wallTime = 0.0;              /**< @brief Seconds spent in `run`. */
+};
+
+#endif // TUNER_H
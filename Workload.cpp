@@ -0,0 +1,162 @@
+#include "Workload.h"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <algorithm>
+#include <cctype>
+#include <unordered_map>
+
+namespace
+{
+    std::string toLower(std::string word)
+    {
+        std::transform(word.begin(), word.end(), word.begin(), [](unsigned char c)
+                       { return std::tolower(c); });
+        return word;
+    }
+
+    /**
+     * @brief Returns the names of the optional columns listed after "Priority" in the header.
+     */
+    std::vector<std::string> parseExtraColumns(const std::string &headerLine)
+    {
+        std::istringstream iss(headerLine);
+        std::vector<std::string> columns;
+        std::string word;
+        bool afterPriority = false;
+
+        while (iss >> word)
+        {
+            word = toLower(word);
+            if (afterPriority)
+            {
+                if (word != "phases" && word != "deadline" && word != "period" && word != "tickets" && word != "group" &&
+                    word != "threads" && word != "memory")
+                {
+                    throw std::runtime_error("Unknown column in header: " + word);
+                }
+                columns.push_back(word);
+            }
+            else if (word == "priority")
+            {
+                afterPriority = true;
+            }
+        }
+
+        if (!columns.empty() && std::find(columns.begin(), columns.end() - 1, "phases") != columns.end() - 1)
+        {
+            throw std::runtime_error("The Phases column must be the last column");
+        }
+        return columns;
+    }
+}
+
+Workload Workload::load(const std::string &fileName, int maxProcesses)
+{
+    std::ifstream inputFile(fileName);
+
+    if (!inputFile.is_open())
+    {
+        throw std::runtime_error("Error opening file: " + fileName);
+    }
+
+    return parse(inputFile, maxProcesses);
+}
+
+Workload Workload::parse(std::istream &input, int maxProcesses)
+{
+    std::string headerLine;
+    std::getline(input, headerLine);
+    return parse(headerLine, input, maxProcesses);
+}
+
+Workload Workload::parse(const std::string &headerLine, std::istream &input, int maxProcesses)
+{
+    std::vector<std::string> extraColumns = parseExtraColumns(headerLine);
+
+    Workload workload;
+    std::unordered_map<std::string, int> groupIds;
+    int arrivalTime, burstTime, priority;
+
+    std::string line;
+    int processCount = 0;
+
+    while ((maxProcesses == 0 || processCount < maxProcesses) && std::getline(input, line))
+    {
+        std::istringstream iss(line);
+
+        if (!(iss >> arrivalTime >> burstTime >> priority))
+        {
+            throw std::runtime_error("Invalid line format in file: " + line);
+        }
+        Process p{arrivalTime, burstTime, priority};
+        p.tickets = std::max(1, 100 / std::max(1, priority));
+
+        for (const std::string &column : extraColumns)
+        {
+            if (column == "deadline" || column == "period" || column == "tickets" || column == "memory")
+            {
+                int value;
+                if (!(iss >> value) || value < 0)
+                {
+                    throw std::runtime_error("Invalid line format in file: " + line);
+                }
+                (column == "deadline" ? p.deadline : column == "period" ? p.period : column == "tickets" ? p.tickets : p.memory) = value;
+            }
+            else if (column == "threads")
+            {
+                if (!(iss >> p.threads) || p.threads < 1)
+                {
+                    throw std::runtime_error("Invalid line format in file: " + line);
+                }
+            }
+            else if (column == "group")
+            {
+                std::string path;
+                if (!(iss >> path))
+                {
+                    throw std::runtime_error("Invalid line format in file: " + line);
+                }
+                auto inserted = groupIds.emplace(path, static_cast<int>(workload.groups.size()));
+                if (inserted.second)
+                {
+                    workload.groups.push_back(path);
+                }
+                p.group = inserted.first->second;
+            }
+            else if (column == "phases")
+            {
+                p.phase_offset = workload.phases.size();
+                int length;
+                while (iss >> length)
+                {
+                    workload.phases.push_back(length);
+                }
+                if (!iss.eof())
+                {
+                    throw std::runtime_error("Invalid line format in file: " + line);
+                }
+                p.phase_count = workload.phases.size() - p.phase_offset;
+                if (p.phase_count % 2 != 0)
+                {
+                    throw std::runtime_error("Phases must be (I/O, CPU burst) pairs: " + line);
+                }
+            }
+        }
+
+        if (p.period > 0 && p.deadline == 0)
+        {
+            p.deadline = p.period;
+        }
+        if (p.deadline > 0)
+        {
+            p.absolute_deadline = p.arrival_time + p.deadline;
+        }
+
+        workload.processes.push_back(p);
+
+        processCount++;
+    }
+
+    return workload;
+}
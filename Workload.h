@@ -0,0 +1,84 @@
+/**
+ * @file Workload.h
+ * @brief Defines the `Workload` structure used to read process data from an input file.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ */
+
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include "Process.h"
+#include <istream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The processes described by an input file, in file order.
+ *
+ * A workload is parsed once and can then be handed to any number of simulations.
+ */
+struct Workload
+{
+    /**
+     * @brief The processes read from the file, with process IDs assigned in file order.
+     */
+    std::vector<Process> processes;
+
+    /**
+     * @brief The phase table: (I/O length, CPU burst length) pairs of every multi-phase process.
+     *
+     * Each process refers to its own slice of the table through `phase_offset` and `phase_count`.
+     */
+    std::vector<int> phases;
+
+    /**
+     * @brief Group path of every group ID, in order of first appearance (empty without a Group column).
+     */
+    std::vector<std::string> groups;
+
+    /**
+     * @brief Reads a workload from a text file in the "arrival burst priority" format.
+     *
+     * The first line of the file is a header. Words after "Priority" in the header name
+     * optional extra columns, in order:
+     *   - "Deadline": the relative deadline of the process.
+     *   - "Period": the release period of a periodic task (its deadline defaults to the period).
+     *   - "Tickets": the share of the process under proportional-share algorithms. Without this
+     *     column, tickets are derived from the priority as `100 / priority` (at least 1).
+     *   - "Group": the slash-separated path of the group the process belongs to (e.g. "tenantA/web").
+     *   - "Threads": the number of threads of a parallel job (at least 1), for gang scheduling.
+     *   - "Memory": the memory the process holds from its admission until it completes.
+     *   - "Phases": the rest of the line holds (I/O length, CPU burst length) pairs that the
+     *     process runs after its first CPU burst. It must be the last column.
+     *
+     * @param fileName The name of the input file containing process data.
+     * @param maxProcesses The maximum number of processes to read (0 means no limit).
+     * @return The parsed workload.
+     * @throws std::runtime_error if the file cannot be opened or a line is malformed.
+     */
+    static Workload load(const std::string &fileName, int maxProcesses);
+
+    /**
+     * @brief Reads a workload in the format of `load` from a stream.
+     *
+     * @param input The stream holding the header line and the process lines.
+     * @param maxProcesses The maximum number of processes to read (0 means no limit).
+     * @return The parsed workload.
+     * @throws std::runtime_error if a line is malformed.
+     */
+    static Workload parse(std::istream &input, int maxProcesses);
+
+    /**
+     * @brief Reads the process lines of a workload from a stream whose header line was read separately.
+     *
+     * @param headerLine The header line naming the columns.
+     * @param input The stream holding the process lines.
+     * @param maxProcesses The maximum number of processes to read (0 means no limit).
+     * @return The parsed workload.
+     * @throws std::runtime_error if a line is malformed.
+     */
+    static Workload parse(const std::string &headerLine, std::istream &input, int maxProcesses);
+};
+
+#endif // WORKLOAD_H
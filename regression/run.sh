@@ -0,0 +1,274 @@
+#!/usr/bin/env bash
+#
+# Regression suite: runs every algorithm over the small data files and over generated
+# workloads, diffs the statistics against the golden files, and optionally checks the event
+# rate of the generated workloads against the recorded baseline.
+#
+# Environment:
+#   CHECK_PERF=1       Also fail when the event rate of a generated workload drops below the
+#                      baseline (off by default: the baseline depends on the machine it was
+#                      recorded on).
+#   THRESHOLD=F        With CHECK_PERF=1, the tolerated drop as a fraction (default 0.25).
+#   UPDATE_GOLDEN=1    Rewrite the suite's golden files from this run instead of diffing
+#                      (the golden outputs in the repository root are always diffed).
+#   UPDATE_BASELINE=1  Rewrite the baseline from this run instead of checking it.
+#   REPEAT=N           With CHECK_PERF=1 or UPDATE_BASELINE=1, time the generated workloads
+#                      N times and keep the fastest run (default 3).
+#   RESULTS=FILE       Also write the measurements to FILE.
+
+set -u
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+SUITE=$ROOT/regression
+SIMULATOR=$ROOT/scheduler_simulator
+GENERATOR=$ROOT/workload_generator
+CLIENT=$ROOT/socket_client
+BASELINE=$SUITE/baseline.txt
+THRESHOLD=${THRESHOLD:-0.25}
+REPEAT=${REPEAT:-3}
+CHECK_PERF=${CHECK_PERF:-0}
+UPDATE_BASELINE=${UPDATE_BASELINE:-0}
+
+ALGORITHMS="FIFO SJF Priority RR AdaptiveRR EDF RM Stride Lottery Group"
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+"$GENERATOR" basic 200000 1 > "$WORK/large.txt" || exit 1
+"$GENERATOR" mixed 50000 2 > "$WORK/mixed.txt" || exit 1
+"$GENERATOR" parallel 20000 3 > "$WORK/parallel.txt" || exit 1
+cp "$ROOT/test.txt" "$ROOT/Datafile1-txt.txt" "$SUITE"/traces/*.txt "$WORK/"
+
+failures=0
+measurements="$WORK/measurements.txt"
+printf "%-18s %-30s %-6s %10s %12s %12s %10s\n" workload case result wall_s events events_per_s rss_kib | tee "$measurements"
+
+# run_case WORKLOAD CASE OUTPUT ARGUMENTS...
+#
+# Runs the simulator with ARGUMENTS in the work directory and diffs OUTPUT, the file the run
+# writes, against the golden file of WORKLOAD and CASE. The golden outputs of the data files
+# in the repository root are used when they exist, regression/golden/WORKLOAD-CASE-output.txt
+# otherwise. Runs with --timing=on report their event rate, which is checked against the
+# baseline of WORKLOAD and CASE.
+#
+# The caller may set `runner` to a function run with ARGUMENTS instead of the simulator, and
+# `reference` to another case whose golden file OUTPUT is diffed against.
+run_case()
+{
+    local workload=$1 name=$2 output=$3
+    local golden_name=${reference:-$2} command=${runner:-$SIMULATOR}
+    shift 3
+    local log="$WORK/$workload-$name.log"
+    local timed=0 measured=0 runs=1 result="" rate=0
+
+    case " $* " in
+        *" --timing=on "*) timed=1 ;;
+    esac
+    # Only the generated workloads run long enough for a meaningful event rate.
+    if [ "$timed" = 1 ] && { [ "$workload" = large ] || [ "$workload" = mixed ]; }; then
+        measured=1
+    fi
+    if [ "$measured" = 1 ] && { [ "$CHECK_PERF" = 1 ] || [ "$UPDATE_BASELINE" = 1 ]; }; then
+        runs=$REPEAT
+    fi
+
+    for run in $(seq "$runs"); do
+        if ! (cd "$WORK" && "$command" "$@" > "$log.$run" 2>&1); then
+            result=ERROR
+            cp "$log.$run" "$log"
+            cat "$log"
+            break
+        fi
+        local run_rate
+        run_rate=$(sed -n 's/^Events per second: //p' "$log.$run")
+        if [ "${run_rate:-0}" -ge "$rate" ]; then
+            rate=${run_rate:-0}
+            cp "$log.$run" "$log"
+        fi
+    done
+
+    if [ -z "$result" ]; then
+        # The data files in the repository root come with their own golden outputs.
+        local golden="$ROOT/$workload-$golden_name-output.txt"
+        if [ "$workload" = large ] || [ "$workload" = mixed ] || [ "$workload" = parallel ] || [ ! -f "$golden" ]; then
+            golden="$SUITE/golden/$workload-$golden_name-output.txt"
+        fi
+
+        # Cases diffed against another case's golden file never rewrite it.
+        if [ "${UPDATE_GOLDEN:-0}" = 1 ] && [ -z "${reference:-}" ] && [ "$golden" != "$ROOT/$workload-$golden_name-output.txt" ]; then
+            cp "$WORK/$output" "$golden"
+            result=saved
+        elif [ ! -f "$golden" ]; then
+            result=NOGOLD
+        elif diff -u "$golden" "$WORK/$output" > "$WORK/$workload-$name.diff"; then
+            result=ok
+        else
+            result=DIFF
+            cat "$WORK/$workload-$name.diff"
+        fi
+    fi
+
+    local wall events rss
+    wall=$(sed -n 's/^Wall time (s): //p' "$log")
+    events=$(sed -n 's/^Events: //p' "$log")
+    rss=$(sed -n 's/^Peak RSS (KiB): //p' "$log")
+    if [ "$timed" = 0 ]; then
+        rate=""
+    fi
+
+    if [ "$result" != ERROR ] && [ "$measured" = 1 ] && [ "$CHECK_PERF" = 1 ] && [ "$UPDATE_BASELINE" != 1 ]; then
+        local expected
+        expected=$(awk -v w="$workload" -v a="$name" '$1 == w && $2 == a { print $3 }' "$BASELINE" 2>/dev/null)
+        if [ -n "$expected" ] && awk -v r="$rate" -v e="$expected" -v t="$THRESHOLD" 'BEGIN { exit !(r < e * (1 - t)) }'; then
+            result=SLOW
+            echo "$workload $name: $rate events/s is more than $THRESHOLD below the baseline of $expected"
+        fi
+    fi
+
+    case $result in
+        ok|saved) ;;
+        *) failures=$((failures + 1)) ;;
+    esac
+    printf "%-18s %-30s %-6s %10s %12s %12s %10s\n" "$workload" "$name" "$result" "${wall:--}" "${events:--}" "${rate:--}" "${rss:--}" | tee -a "$measurements"
+}
+
+# serve_requests REQUESTS ARGUMENTS...
+#
+# Starts the simulation server with ARGUMENTS, sends it the file REQUESTS on one connection,
+# and writes the responses to server-responses.txt. REQUESTS should end with SHUTDOWN.
+serve_requests()
+{
+    local requests=$1
+    shift
+    "$SIMULATOR" --serve "$WORK/server.sock" "$@" &
+    local server=$!
+    if ! "$CLIENT" "$WORK/server.sock" < "$requests" > server-responses.txt; then
+        kill "$server"
+        wait "$server"
+        return 1
+    fi
+    wait "$server"
+}
+
+# resume_from_checkpoint DATA_FILE ARGUMENTS...
+#
+# Simulates the first half of DATA_FILE with a checkpoint, appends the second half, and
+# simulates the grown file again, which must resume from the checkpoint. Both runs happen in a
+# fresh checkpoint directory, where the grown file keeps the name of DATA_FILE.
+resume_from_checkpoint()
+{
+    local data=$1
+    shift
+    local lines half status
+    lines=$(wc -l < "$data")
+    half=$(((lines + 1) / 2))
+    rm -rf checkpoint
+    mkdir checkpoint
+    head -n "$half" "$data" > "checkpoint/$data"
+    (cd checkpoint && "$SIMULATOR" "$data" "$@" --checkpoint=on) || return 1
+    tail -n +"$((half + 1))" "$data" >> "checkpoint/$data"
+    status=$(cd checkpoint && "$SIMULATOR" "$data" "$@" --checkpoint=on) || return 1
+    echo "$status"
+    case $status in
+        "Resumed from "*) ;;
+        *) return 1 ;;
+    esac
+}
+
+for workload in test Datafile1-txt large mixed; do
+    # The golden outputs of the data files use the default process limit.
+    limit=""
+    if [ "$workload" = large ] || [ "$workload" = mixed ]; then
+        limit="--max-processes=0"
+    fi
+    for algorithm in $ALGORITHMS; do
+        run_case "$workload" "$algorithm" "$workload-$algorithm-output.txt" "$workload.txt" "$algorithm" $limit --timing=on
+    done
+done
+
+# Handling a time step's events together must dispatch exactly like handling them one at a time,
+# on random workloads dense in simultaneous, preempting arrivals, on several CPUs.
+for algorithm in SJF Priority EDF RR Group; do
+    run_case Datafile1-txt "$algorithm-differential" "Datafile1-txt-$algorithm-differential.log" Datafile1-txt.txt "$algorithm" \
+        --differential=100 --cpus=2x2.0,2x1.0 --switch-cost=1
+done
+
+# Gang scheduling has its own event loop and statistics: 20,000 jobs of 1 to 8 threads on 8 CPUs.
+for algorithm in Gang Backfill; do
+    run_case parallel "$algorithm" "parallel-$algorithm-output.txt" parallel.txt "$algorithm" --max-processes=0 --cpus=8x1.0
+done
+
+# Memory admission under every policy; with a memory limit the waiting time only counts the wait for a CPU.
+for policy in fifo best-fit drf; do
+    run_case mixed "RR-memory-$policy" "mixed-RR-output.txt" mixed.txt RR --max-processes=0 --memory=500 \
+        --memory-policy="$policy" --cpus=2x1.0 --io-devices=4
+done
+
+# A data file that grows between runs: resuming from a checkpoint must give the statistics of a full run.
+for algorithm in FIFO SJF Priority RR EDF RM; do
+    runner=resume_from_checkpoint reference=$algorithm run_case large "$algorithm-checkpoint" "checkpoint/large-$algorithm-output.txt" \
+        large.txt "$algorithm" --max-processes=0
+done
+
+# The server answers the requests of one connection in order, from uploaded workloads and data files.
+{
+    # test.txt does not end with a newline, which awk adds.
+    echo "WORKLOAD uploaded $(awk 'END { print NR }' "$ROOT/test.txt")"
+    awk 1 "$ROOT/test.txt"
+    echo "RUN uploaded FIFO"
+    echo "RUN uploaded RR --quantum=2"
+    echo "RUN Datafile1-txt.txt SJF"
+    echo "RUN Datafile1-txt.txt Priority --cpus=2x1.0 --switch-cost=1"
+    echo "RUN Datafile1-txt.txt SJF"
+    echo "RUN uploaded FIFO --checkpoint=on"
+    echo "RUN uploaded FIFO --timing=on"
+    echo "RUN uploaded Unknown"
+    echo "STATS"
+    echo "SHUTDOWN"
+} > "$WORK/server-requests.txt"
+runner=serve_requests run_case Datafile1-txt server "server-responses.txt" server-requests.txt --threads=2
+
+# Trace import: the converted workloads of small ftrace and perf dumps with preemptions, exits,
+# a reused PID and a task running when the trace starts.
+run_case sched-ftrace import "sched-ftrace-workload.txt" sched-ftrace.txt FIFO --input-format=trace
+run_case sched-perf import "sched-perf-workload.txt" sched-perf.txt FIFO --input-format=trace --trace-unit=10
+
+# Clusters: every routing strategy spreads the large workload over two nodes.
+for routing in random round-robin jsq p2c; do
+    run_case large "SJF-cluster-$routing" "large-SJF-cluster-output.txt" large.txt SJF --max-processes=0 --nodes=2 \
+        --routing="$routing" --network-delay=2
+done
+
+# Admission control: the large workload overloads one CPU, so a bounded ready queue rejects or sheds
+# under every policy; the token bucket admits fewer arrivals than the workload brings.
+for admission in reject drop-oldest drop-lowest-priority token-bucket; do
+    run_case large "Priority-$admission" "large-Priority-output.txt" large.txt Priority --max-processes=0 --queue-capacity=20 \
+        --admission="$admission" --token-rate=0.15
+done
+
+# Per-process exports in both formats; the columnar golden file is binary.
+run_case Datafile1-txt SJF-export-csv "Datafile1-txt-SJF-export.csv" Datafile1-txt.txt SJF \
+    --export=Datafile1-txt-SJF-export.csv --export-format=csv
+run_case Datafile1-txt SJF-export-columnar "Datafile1-txt-SJF-export.bin" Datafile1-txt.txt SJF \
+    --export=Datafile1-txt-SJF-export.bin --export-format=columnar
+
+# Tuner candidates of every magnitude must reach the simulations as valid option values.
+run_case Datafile1-txt RR-tuning "Datafile1-txt-RR-tuning-output.txt" Datafile1-txt.txt RR --tune=grid \
+    --tune-space=quantum:1:3000001:1000000,cache-warm-window:0:20000000:10000000
+
+if [ "$UPDATE_BASELINE" = 1 ]; then
+    {
+        echo "# workload algorithm events_per_second"
+        awk '($1 == "large" || $1 == "mixed") && $3 != "ERROR" && $6 != "-" { print $1, $2, $6 }' "$measurements"
+    } > "$BASELINE"
+    echo "Baseline written to $BASELINE"
+fi
+if [ -n "${RESULTS:-}" ]; then
+    cp "$measurements" "$RESULTS"
+fi
+
+if [ "$failures" -gt 0 ]; then
+    echo "$failures regression check(s) failed"
+    exit 1
+fi
+echo "All regression checks passed"
@@ -0,0 +1,94 @@
+/**
+ * @file socket_client.cpp
+ * @brief Sends requests to the simulation server for the regression suite.
+ * @author Shawn Maybush
+ * @date 2026-10-18
+ *
+ * Usage: socket_client <socket_path>
+ *
+ * Connects to the server's Unix domain socket, waiting up to five seconds for the server to
+ * start listening, sends standard input on one connection, closes the sending side, and copies
+ * every response to standard output until the server closes the connection.
+ */
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <socket_path>" << std::endl;
+        return 1;
+    }
+
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (std::strlen(argv[1]) >= sizeof(address.sun_path))
+    {
+        std::cerr << "Socket path too long: " << argv[1] << std::endl;
+        return 1;
+    }
+    std::strcpy(address.sun_path, argv[1]);
+
+    int fd = -1;
+    for (int attempt = 0; fd < 0 && attempt < 100; attempt++)
+    {
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd >= 0 && connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+        {
+            close(fd);
+            fd = -1;
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+    }
+    if (fd < 0)
+    {
+        std::cerr << "Cannot connect to " << argv[1] << ": " << std::strerror(errno) << std::endl;
+        return 1;
+    }
+
+    std::string requests((std::istreambuf_iterator<char>(std::cin)), std::istreambuf_iterator<char>());
+    size_t sent = 0;
+    while (sent < requests.size())
+    {
+        ssize_t written = send(fd, requests.data() + sent, requests.size() - sent, MSG_NOSIGNAL);
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (written <= 0)
+        {
+            std::cerr << "Error sending requests: " << std::strerror(errno) << std::endl;
+            return 1;
+        }
+        sent += written;
+    }
+    shutdown(fd, SHUT_WR);
+
+    char chunk[65536];
+    ssize_t count;
+    while ((count = read(fd, chunk, sizeof(chunk))) != 0)
+    {
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (count < 0)
+        {
+            std::cerr << "Error reading responses: " << std::strerror(errno) << std::endl;
+            return 1;
+        }
+        std::cout.write(chunk, count);
+    }
+    close(fd);
+    return 0;
+}